@@ -11,6 +11,9 @@
 // std::nullptr_t
 #include <cstddef>
 
+// std::hash
+#include <functional>
+
 // Nullable Template
 // https://stackoverflow.com/questions/2537942/nullable-values-in-c/28811646#28811646
 
@@ -115,4 +118,18 @@ namespace BOT_ORM
     }
 }
 
+// Hash of Nullable (for Keys of Hash Maps)
+
+namespace std
+{
+    template <typename T>
+    struct hash<BOT_ORM::Nullable<T>>
+    {
+        size_t operator () (const BOT_ORM::Nullable<T> &op) const
+        {
+            return op == nullptr ? 0 : hash<T> {} (op.Value ());
+        }
+    };
+}
+
 #endif // !BOT_ORM_NULLABLE_H
@@ -13,22 +13,41 @@
 #include <list>
 #include <string>
 #include <unordered_map>
+#include <iterator>
 
 // Serialization
 #include <sstream>
+#include <cstring>
+
+// for SQL Writer
+#include <cstdio>
+#include <cstdlib>
+#include <clocale>
+#include <limits>
 
 // Type Traits
 #include <type_traits>
 
+// Fixed Width Integers
+#include <cstdint>
+
 // std::shared_ptr
 #include <memory>
 
 // for Field Name Extractor
 #include <cctype>
 
+// for Primary Key Lookup
+#include <algorithm>
+
 // for SQL Connector
 #include <thread>
 #include <functional>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <condition_variable>
 
 // SQLite 3 Dependency
 #include "sqlite3.h"
@@ -53,18 +72,460 @@ constexpr static const char *__TableName =  _TABLE_NAME_; \
 // Private Macros
 
 #define NO_ORMAP "Please Inject the Class with 'ORMAP' first"
-#define BAD_TYPE "Only Support Integral, Floating Point and std::string"
+#define BAD_TYPE "Only Support Integral, Floating Point, std::string and Blob"
 
 #define BAD_COLUMN_COUNT "Bad Column Count"
 #define NULL_DESERIALIZE "Get Null Value"
 
 #define NO_FIELD "No Such Field for current Extractor"
 #define NOT_SAME_TABLE "Fields are NOT from the Same Table"
+#define NOT_INDEX "Constraint is NOT an Index"
+#define NOT_UNIQUE "Constraint is NOT Unique"
+#define BAD_SPATIAL "Spatial Index requires 1 to 5 Pairs of Min/Max Fields"
+#define BAD_BOX "Box does NOT Match the Spatial Index"
+#define NO_ROWID_INDEX "Full-text / Spatial Index requires a Rowid Table"
+
+#define BAD_QUERY_PLAN "Bad Query Plan: "
+#define QUERY_TIMEOUT "Query Timeout"
+#define QUERY_CANCELLED "Query Cancelled"
+#define NOT_WAL_MODE "Snapshot requires WAL Mode"
+#define NOT_IN_MEMORY "Write-behind requires an In-memory Database"
+#define WRITE_ONLY_BLOB "BlobView is Write-only"
+#define BAD_BLOB "Bad Blob Value"
+#define BAD_COMPRESSED "Bad Compressed Value"
+
+#define BAD_GROUP_KEY "Key does NOT Identify the Groups"
+
+#define NO_ORDER "Keyset Pagination requires OrderBy"
+#define BAD_SEEK_KEY "Seek Keys do NOT Match OrderBy"
+#define BAD_PAGE_TOKEN "Bad Page Token"
+
+// Instrumentation
+
+namespace BOT_ORM
+{
+    // A Step of 'EXPLAIN QUERY PLAN'
+    // (For SQLite >= 3.24.0, the Integers are 'id', 'parent' and 'notused')
+
+    struct QueryPlan
+    {
+        int selectId;
+        int order;
+        int from;
+        std::string detail;
+
+        // Scan a Table without Index
+        bool IsFullScan () const
+        {
+            return detail.compare (0, 5, "SCAN ") == 0 &&
+                detail.find (" USING ") == std::string::npos &&
+                detail.find ("SUBQUERY") == std::string::npos &&
+                detail.find ("VIRTUAL TABLE") == std::string::npos &&
+                detail.find ("CONSTANT ROW") == std::string::npos;
+        }
+
+        // Use Temp B-Tree for ORDER BY / GROUP BY / DISTINCT
+        bool UsesTempBTree () const
+        {
+            return detail.find ("TEMP B-TREE") != std::string::npos;
+        }
+
+        // Build an Automatic Index for this Query
+        bool UsesAutoIndex () const
+        {
+            return detail.find ("AUTOMATIC") != std::string::npos;
+        }
+    };
+
+    // Counters of 'sqlite3_stmt_status'
+
+    struct QueryStats
+    {
+        int fullScanSteps;
+        int sorts;
+        int autoIndexes;
+        int vmSteps;
+
+        // Values of Compressed Fields Decompressed by the Query
+        // (only the Retrieved Columns)
+        int decompressed;
+        std::chrono::microseconds decompressTime;
+    };
+
+    // Instrumentation Output of a Query
+
+    struct QueryReport
+    {
+        std::string sql;
+        QueryStats stats;
+
+        // Only Set if Query Advisor is Enabled
+        std::vector<QueryPlan> plan;
+        std::vector<std::string> issues;
+    };
+
+    // Thrown if a Query is Interrupted by Timeout or Cancellation
+
+    class QueryInterrupted : public std::runtime_error
+    {
+    public:
+        QueryInterrupted (const std::string &what, bool timedOut)
+            : std::runtime_error (what), _timedOut (timedOut)
+        {}
+
+        bool TimedOut () const { return _timedOut; }
+
+    private:
+        bool _timedOut;
+    };
+
+    // Cancel Queries from any Thread
+    // - Copies Share the Same State
+
+    class CancellationToken
+    {
+    public:
+        CancellationToken ()
+            : _cancelled (std::make_shared<std::atomic<bool>> (false))
+        {}
+
+        void Cancel () const { *_cancelled = true; }
+        bool IsCancelled () const { return *_cancelled; }
+
+    private:
+        std::shared_ptr<std::atomic<bool>> _cancelled;
+
+        template <typename QueryResult> friend class Queryable;
+    };
+
+    // Change of a Row Reported after Commit
+
+    struct RowChange
+    {
+        enum class Operation { Insert, Update, Delete };
+
+        Operation operation;
+        std::string table;
+        long long rowid;
+    };
+
+    // Counters of Background Checkpoints
+
+    struct CheckpointStats
+    {
+        size_t checkpoints;
+        size_t truncations;
+        size_t framesCheckpointed;
+
+        // Frames in the WAL File after the Last Checkpoint
+        int walFrames;
+
+        std::chrono::microseconds elapsed;
+        std::string lastError;
+    };
+
+    // Counters of Compressed Fields (on Insert / Update)
+
+    struct CompressionStats
+    {
+        size_t values;
+
+        // Values Stored Compressed (the Others were NOT Smaller)
+        size_t compressed;
+
+        // Ratio is 'rawBytes / storedBytes'
+        size_t rawBytes;
+        size_t storedBytes;
+
+        std::chrono::microseconds compressTime;
+    };
+}
+
+// Blob
+
+namespace BOT_ORM
+{
+    // Binary Field (Mapped to 'blob')
+    using Blob = std::vector<std::uint8_t>;
+
+    // Non-owning View of Binary Data (Mapped to 'blob')
+    // - Bound without Copying, so 'data' must Outlive the Statement
+    // - 'data == nullptr' Reserves 'size' Zero Bytes
+    //   (to be Written by 'BlobStream')
+    // - Write-only (Query with a 'Blob' Field instead)
+    struct BlobView
+    {
+        const void *data;
+        size_t size;
+
+        BlobView (const void *_data = nullptr, size_t _size = 0)
+            : data (_data), size (_size)
+        {}
+
+        BlobView (const Blob &blob)
+            : data (blob.data ()), size (blob.size ())
+        {}
+    };
+}
+
+// Named Table
+
+namespace BOT_ORM
+{
+    // Table Named 'tableName' with the Fields of C
+    // (e.g. Exposed by 'ORMapper::Expose')
+    // - Pass to 'Query' / 'Join' / 'LeftJoin' / 'FieldExtractor'
+    //   in place of 'helper'
+
+    template <typename C>
+    struct NamedTable
+    {
+        std::string tableName;
+        const C &helper;
+    };
+
+    template <typename C>
+    inline NamedTable<C> Named (std::string tableName, const C &helper)
+    {
+        return NamedTable<C> { std::move (tableName), helper };
+    }
+}
 
 // Helpers
 
 namespace BOT_ORM_Impl
 {
+    // Deadline and Cancellation of a Query
+    // (Zero 'timeout' means No Deadline)
+
+    struct QueryLimits
+    {
+        std::chrono::milliseconds timeout { 0 };
+        std::shared_ptr<const std::atomic<bool>> cancelled;
+    };
+
+    // Column of a Row Stepped by 'ExecuteQuery'
+    // - Read by the Type of the Field it is Retrieved into
+    // - 'text' is the Decompressed Value of a Compressed Field
+
+    struct ColumnValue
+    {
+        sqlite3_stmt *stmt;
+        int index;
+        const std::string *text;
+    };
+
+    // Key of Cached Statements
+    // - 'model' is the Address of the Table Name of the Model
+    // - 'mask' marks the Bound Fields (for Insert),
+    //   or the Key Fields other than Primary Key (for Update / Select),
+    //   or the Count of Parameters (for DeleteIn)
+
+    enum class StatementKind { Insert, Update, Delete, DeleteIn, Select };
+
+    struct StatementKey
+    {
+        const void *model;
+        StatementKind kind;
+        std::uint64_t mask;
+
+        bool operator == (const StatementKey &rhs) const
+        {
+            return model == rhs.model && kind == rhs.kind &&
+                mask == rhs.mask;
+        }
+    };
+
+    struct StatementKeyHash
+    {
+        size_t operator () (const StatementKey &key) const
+        {
+            return std::hash<const void *> {} (key.model) ^
+                (std::hash<std::uint64_t> {} (key.mask) << 2) ^
+                size_t (key.kind);
+        }
+    };
+
+    // Append Bytes in Hex Digits
+
+    inline void AppendHex (std::string &out, const void *data, size_t size)
+    {
+        static const char digits[] = "0123456789ABCDEF";
+        auto bytes = static_cast<const std::uint8_t *> (data);
+        out.reserve (out.size () + size * 2);
+        for (size_t i = 0; i < size; i++)
+        {
+            out += digits[bytes[i] >> 4];
+            out += digits[bytes[i] & 0xF];
+        }
+    }
+
+    // LZ Codec (for Compressed Fields)
+    // - Format: Varint of Raw Size, then LZ4-like Sequences of
+    //   Token (Literal Length << 4 | Match Length - 4), Literals,
+    //   2-byte Offset and Extended Lengths (255, 255, ..., < 255)
+    // - The Last Sequence has Literals Only
+
+    struct LZCodec
+    {
+        // Return false if the Output is NOT Smaller
+        static bool Compress (const char *src, size_t size,
+            std::string &out)
+        {
+            out.clear ();
+            out.reserve (size);
+            for (auto n = size; ; n >>= 7)
+            {
+                out += char (n < 0x80 ? n : (n & 0x7F) | 0x80);
+                if (n < 0x80)
+                    break;
+            }
+
+            // Position + 1 of the Last 4 Bytes with the Same Hash
+            std::vector<std::uint32_t> table (1 << HASH_BITS, 0);
+            size_t anchor = 0, pos = 0;
+            while (pos + MIN_MATCH <= size)
+            {
+                auto seq = Read32 (src + pos);
+                auto &slot = table[(seq * 2654435761u) >> (32 - HASH_BITS)];
+                size_t candidate = slot;
+                slot = std::uint32_t (pos + 1);
+
+                if (candidate == 0 || pos + 1 - candidate > MAX_OFFSET ||
+                    Read32 (src + candidate - 1) != seq)
+                {
+                    pos++;
+                    continue;
+                }
+
+                auto match = candidate - 1;
+                auto length = MIN_MATCH;
+                while (pos + length < size &&
+                    src[match + length] == src[pos + length])
+                    length++;
+
+                WriteSequence (out, src + anchor, pos - anchor,
+                    pos - match, length);
+                pos += length;
+                anchor = pos;
+                if (out.size () >= size)
+                    return false;
+            }
+            WriteSequence (out, src + anchor, size - anchor, 0, 0);
+            return out.size () < size;
+        }
+
+        // Return false if 'src' is Corrupted
+        static bool Decompress (const char *src, size_t size,
+            std::string &out)
+        {
+            auto bytes = reinterpret_cast<const std::uint8_t *> (src);
+            auto end = bytes + size;
+
+            size_t rawSize = 0;
+            for (int shift = 0; ; shift += 7)
+            {
+                if (bytes == end || shift > 56)
+                    return false;
+                rawSize |= size_t (*bytes & 0x7F) << shift;
+                if (*bytes++ < 0x80)
+                    break;
+            }
+
+            // Each Input Byte Expands to at most 255 Output Bytes,
+            // so a Corrupt Raw Size can't Drive the Allocation
+            out.clear ();
+            out.reserve (std::min (rawSize, size_t (end - bytes) * 255 + 16));
+            while (bytes < end)
+            {
+                auto token = *bytes++;
+                size_t literals = token >> 4;
+                if (!ReadLength (bytes, end, literals) ||
+                    size_t (end - bytes) < literals ||
+                    out.size () + literals > rawSize)
+                    return false;
+                out.append (reinterpret_cast<const char *> (bytes),
+                    literals);
+                bytes += literals;
+                if (bytes == end)
+                    break;
+
+                if (end - bytes < 2)
+                    return false;
+                size_t offset = bytes[0] | size_t (bytes[1]) << 8;
+                bytes += 2;
+                size_t length = token & 0xF;
+                if (!ReadLength (bytes, end, length))
+                    return false;
+                length += MIN_MATCH;
+                if (offset == 0 || offset > out.size () ||
+                    out.size () + length > rawSize)
+                    return false;
+
+                // Byte by Byte as the Match may Overlap the Output
+                auto from = out.size () - offset;
+                for (size_t i = 0; i < length; i++)
+                    out += out[from + i];
+            }
+            return out.size () == rawSize;
+        }
+
+    private:
+        constexpr static int HASH_BITS = 12;
+        constexpr static size_t MIN_MATCH = 4;
+        constexpr static size_t MAX_OFFSET = 0xFFFF;
+
+        static std::uint32_t Read32 (const char *src)
+        {
+            std::uint32_t ret;
+            std::memcpy (&ret, src, sizeof (ret));
+            return ret;
+        }
+
+        static void WriteLength (std::string &out, size_t length)
+        {
+            for (; length >= 255; length -= 255)
+                out += char (255);
+            out += char (length);
+        }
+
+        static bool ReadLength (const std::uint8_t *&bytes,
+            const std::uint8_t *end, size_t &length)
+        {
+            if (length != 15)
+                return true;
+            for (;;)
+            {
+                if (bytes == end)
+                    return false;
+                auto byte = *bytes++;
+                length += byte;
+                if (byte != 255)
+                    return true;
+            }
+        }
+
+        // No Match if 'length' is 0
+        static void WriteSequence (std::string &out,
+            const char *literals, size_t literalCount,
+            size_t offset, size_t length)
+        {
+            auto matchCode = length ? length - MIN_MATCH : 0;
+            out += char ((std::min<size_t> (literalCount, 15) << 4) |
+                std::min<size_t> (matchCode, 15));
+            if (literalCount >= 15)
+                WriteLength (out, literalCount - 15);
+            out.append (literals, literalCount);
+            if (!length)
+                return;
+
+            out += char (offset & 0xFF);
+            out += char (offset >> 8);
+            if (matchCode >= 15)
+                WriteLength (out, matchCode - 15);
+        }
+    };
+
     // Naive SQL Driver (Todo: Improved Later)
 
     class SQLConnector
@@ -80,6 +541,11 @@ namespace BOT_ORM_Impl
 
         ~SQLConnector ()
         {
+            ClearStatements ();
+#ifdef SQLITE_ENABLE_SESSION
+            if (session)
+                sqlite3session_delete (session);
+#endif  // SQLITE_ENABLE_SESSION
             sqlite3_close (db);
         }
 
@@ -87,6 +553,7 @@ namespace BOT_ORM_Impl
         {
             char *zErrMsg = 0;
             int rc = SQLITE_OK;
+            const auto changeMark = changes.size ();
 
             for (size_t iTry = 0; iTry < MAX_TRIAL; iTry++)
             {
@@ -103,8 +570,10 @@ namespace BOT_ORM_Impl
                 auto errStr = std::string ("SQL error: '") + zErrMsg
                     + "' at '" + cmd + "'";
                 sqlite3_free (zErrMsg);
+                DropChanges (changeMark);
                 throw std::runtime_error (errStr);
             }
+            NotifyChanges ();
         }
 
         void ExecuteCallback (const std::string &cmd,
@@ -115,6 +584,7 @@ namespace BOT_ORM_Impl
             int rc = SQLITE_OK;
 
             auto callbackParam = std::make_pair (&callback, std::string {});
+            const auto changeMark = changes.size ();
 
             for (size_t iTry = 0; iTry < MAX_TRIAL; iTry++)
             {
@@ -139,1568 +609,6300 @@ namespace BOT_ORM_Impl
                 auto errStr = std::string ("SQL error: '") + zErrMsg
                     + "' at '" + cmd + "'";
                 sqlite3_free (zErrMsg);
+                DropChanges (changeMark);
                 throw std::runtime_error (errStr);
             }
+            NotifyChanges ();
         }
 
-    private:
-        sqlite3 *db;
-        constexpr static size_t MAX_TRIAL = 16;
+        std::vector<BOT_ORM::QueryPlan> Explain (const std::string &cmd)
+        {
+            std::vector<BOT_ORM::QueryPlan> ret;
+            ExecuteCallback ("explain query plan " + cmd,
+                [&ret] (int argc, char **argv)
+            {
+                if (argc != 4)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
 
-        static int CallbackWrapper (
-            void *callbackParam, int argc, char **argv, char **)
+                ret.push_back (BOT_ORM::QueryPlan {
+                    std::stoi (argv[0]), std::stoi (argv[1]),
+                    std::stoi (argv[2]), argv[3] });
+            });
+            return ret;
+        }
+
+        // Query with Instrumentation
+        // - Check the Query Plan first if Advisor is Enabled
+        //   ('isFullRead' means scanning the whole Table is Expected)
+        // - Interrupt the Query if it Exceeds 'limits'
+        // - Report Statistics to Query Listener
+        void ExecuteQuery (const std::string &cmd,
+            std::function<void (int, const ColumnValue *)> callback,
+            bool isFullRead = false,
+            const QueryLimits &limits = QueryLimits {})
         {
-            auto pParam = static_cast<std::pair<
-                std::function<void (int, char **)> *,
-                std::string
-            >*>(callbackParam);
+            BOT_ORM::QueryReport report;
+            report.sql = cmd;
 
-            try
-            {
-                pParam->first->operator()(argc, argv);
-                return 0;
-            }
-            catch (const std::exception &ex)
+            if (adviseQuery)
             {
-                pParam->second = ex.what ();
-                return 1;
+                report.plan = Explain (cmd);
+                for (const auto &step : report.plan)
+                    if ((step.IsFullScan () && !isFullRead) ||
+                        step.UsesTempBTree () || step.UsesAutoIndex ())
+                        report.issues.push_back (step.detail);
+
+                if (!report.issues.empty () && throwOnIssue)
+                    throw std::runtime_error (
+                        std::string ("SQL error: '") + BAD_QUERY_PLAN +
+                        report.issues.front () + "' at '" + cmd + "'");
             }
-        }
-    };
 
-    // Helper - Field Type Checker
+            report.stats = ExecuteStatement (cmd, callback, limits);
 
-    template <typename T>
-    struct TypeString
-    {
-        constexpr static const char *typeStr =
-            (std::is_integral<T>::value &&
-                !std::is_same<T, char>::value &&
-                !std::is_same<T, wchar_t>::value &&
-                !std::is_same<T, char16_t>::value &&
-                !std::is_same<T, char32_t>::value &&
-                !std::is_same<T, unsigned char>::value)
-            ? " integer not null"
-            : (std::is_floating_point<T>::value)
-            ? " real not null"
-            : (std::is_same<T, std::string>::value)
-            ? " text not null"
-            : nullptr;
+            if (queryListener)
+                queryListener (report);
+        }
 
-        static_assert (typeStr != nullptr, BAD_TYPE);
-    };
+        void SetQueryListener (
+            std::function<void (const BOT_ORM::QueryReport &)> listener)
+        {
+            queryListener = std::move (listener);
+        }
 
-    template <typename T>
-    struct TypeString <BOT_ORM::Nullable<T>>
-    {
-        constexpr static const char *typeStr =
-            (std::is_integral<T>::value &&
-                !std::is_same<T, char>::value &&
-                !std::is_same<T, wchar_t>::value &&
-                !std::is_same<T, char16_t>::value &&
-                !std::is_same<T, char32_t>::value &&
-                !std::is_same<T, unsigned char>::value)
-            ? " integer"
-            : (std::is_floating_point<T>::value)
-            ? " real"
-            : (std::is_same<T, std::string>::value)
-            ? " text"
-            : nullptr;
+        void SetQueryAdvisor (bool enable, bool throwIssue)
+        {
+            adviseQuery = enable;
+            throwOnIssue = throwIssue;
+        }
 
-        static_assert (typeStr != nullptr, BAD_TYPE);
-    };
+        // Get a Cached Statement
+        // - Prepare the Statement of 'getSql ()' if NOT Cached
+        // - Finalized before Closing the Connection
+        template <typename Fn>
+        sqlite3_stmt *Prepare (const StatementKey &key, Fn getSql)
+        {
+            auto cached = statements.find (key);
+            if (cached != statements.end ())
+                return cached->second;
 
-    // Serialization Helper
+            auto stmt = PrepareStatement (getSql ());
+            statements.emplace (key, stmt);
+            return stmt;
+        }
 
-    struct SerializationHelper
-    {
-        template <typename T>
-        static inline
-            std::enable_if_t<TypeString<T>::typeStr == nullptr, bool>
-            Serialize (std::ostream &, const T &)
-        {}
-        template <typename T>
-        static inline
-            std::enable_if_t<TypeString<T>::typeStr != nullptr, bool>
-            Serialize (std::ostream &os, const T &value)
+        void ClearStatements ()
         {
-            os << value;
-            return true;
+            for (const auto &statement : statements)
+                sqlite3_finalize (statement.second);
+            statements.clear ();
         }
 
-        static inline bool Serialize (std::ostream &os,
-            const std::string &value)
+        // Step a Cached Statement to the End
+        // - Call 'callback' on each Row
+        // - Reset the Statement and Clear the Bindings afterwards,
+        //   before Notifying the Changes (so Listeners can Reuse it)
+        template <typename Fn>
+        void StepStatement (sqlite3_stmt *stmt, Fn callback)
         {
-            os << "'" << value << "'";
-            return true;
+            std::unique_ptr<sqlite3_stmt, decltype (&ResetStatement)>
+                stmtGuard { stmt, ResetStatement };
+
+            int rc = SQLITE_OK;
+            auto anyRow = false;
+            const auto changeMark = changes.size ();
+            for (size_t iTry = 0; ; )
+            {
+                rc = sqlite3_step (stmt);
+                if (rc == SQLITE_ROW)
+                {
+                    anyRow = true;
+                    try
+                    {
+                        callback ();
+                    }
+                    catch (const std::exception &ex)
+                    {
+                        throw std::runtime_error (
+                            std::string ("SQL error: '") + ex.what () +
+                            "' at '" + sqlite3_sql (stmt) + "'");
+                    }
+                }
+                else if (rc == SQLITE_BUSY && !anyRow &&
+                    ++iTry < MAX_TRIAL)
+                {
+                    sqlite3_reset (stmt);
+                    std::this_thread::sleep_for (
+                        std::chrono::microseconds (20));
+                }
+                else
+                    break;
+            }
+
+            if (rc != SQLITE_DONE)
+            {
+                DropChanges (changeMark);
+                throw std::runtime_error (std::string ("SQL error: '") +
+                    sqlite3_errmsg (db) + "' at '" +
+                    sqlite3_sql (stmt) + "'");
+            }
+            stmtGuard.reset ();
+            NotifyChanges ();
         }
 
-        template <typename T>
-        static inline bool Serialize (
-            std::ostream &os,
-            const BOT_ORM::Nullable<T> &value)
+        void StepStatement (sqlite3_stmt *stmt)
         {
-            if (value == nullptr)
-                return false;
-            return Serialize (os, value.Value ());
+            StepStatement (stmt, [] {});
         }
-    };
 
-    // Deserialization Helper
+        // Path of the Database File (Empty for In-memory Databases)
+        std::string FileName () const
+        {
+            auto fileName = sqlite3_db_filename (db, "main");
+            return fileName ? fileName : std::string {};
+        }
 
-    struct DeserializationHelper
-    {
-        template <typename T>
-        static inline std::enable_if_t<TypeString<T>::typeStr == nullptr>
-            Deserialize (T &, const char *)
-        {}
-        template <typename T>
-        static inline std::enable_if_t<TypeString<T>::typeStr != nullptr>
-            Deserialize (T &property, const char *value)
+        // Rows Modified by the Last Statement
+        int Changes () const
         {
-            if (value) std::istringstream { value } >> property;
-            else throw std::runtime_error (NULL_DESERIALIZE);
+            return sqlite3_changes (db);
         }
 
-        static inline void Deserialize (std::string &property,
-            const char *value)
+        // Max Number of Parameters of a Statement
+        int MaxVariables () const
         {
-            if (value) property = value;
-            else throw std::runtime_error (NULL_DESERIALIZE);
+            return sqlite3_limit (db, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
         }
 
-        template <typename T>
-        static inline void Deserialize (
-            BOT_ORM::Nullable<T> &property, const char *value)
+        sqlite3_int64 LastInsertRowid () const
         {
-            if (value)
+            return sqlite3_last_insert_rowid (db);
+        }
+
+        bool InTransaction () const
+        {
+            return sqlite3_get_autocommit (db) == 0;
+        }
+
+        // Call 'listener' with the Changes of 'table' after Commits
+        // - Changes are Buffered until Commit, and Dropped at Rollback
+        void AddChangeListener (const std::string &table,
+            std::function<void (const BOT_ORM::RowChange &)> listener)
+        {
+            if (changeListeners.empty ())
             {
-                T val;
-                Deserialize (val, value);
-                property = val;
+                sqlite3_update_hook (db, UpdateHook, this);
+                sqlite3_commit_hook (db, CommitHook, this);
+                sqlite3_rollback_hook (db, RollbackHook, this);
             }
-            else
-                property = nullptr;
+            changeListeners[table].push_back (std::move (listener));
         }
-    };
 
-    // Injection Helper
+#ifdef SQLITE_ENABLE_SESSION
+        // Record Changes of 'table' into the Session
+        void RecordChanges (const std::string &table)
+        {
+            if (!session)
+                OpenSession ();
+            CheckSession (sqlite3session_attach (session, table.c_str ()));
+            sessionTables.push_back (table);
+        }
 
-    class InjectionHelper
-    {
-        static std::vector<std::string> ExtractFieldName (std::string input)
+        // Take the Changeset Recorded since the Last Call
+        std::string TakeChangeset ()
         {
-            std::vector<std::string> ret;
-            std::string tmpStr;
+            if (!session)
+                return std::string {};
+
+            int size = 0;
+            void *data = nullptr;
+            CheckSession (sqlite3session_changeset (session, &size, &data));
+            std::string ret (static_cast<const char *> (data), size);
+            sqlite3_free (data);
+
+            // Restart Recording
+            sqlite3session_delete (session);
+            session = nullptr;
+            OpenSession ();
+            for (const auto &table : sessionTables)
+                CheckSession (sqlite3session_attach (
+                    session, table.c_str ()));
+            return ret;
+        }
 
-            for (char ch : std::move (input) + ",")
+        // Apply a Changeset (Abort at Conflicts)
+        void ApplyChangeset (const std::string &changeset)
+        {
+            const auto changeMark = changes.size ();
+            auto rc = sqlite3changeset_apply (db,
+                static_cast<int> (changeset.size ()),
+                const_cast<char *> (changeset.data ()), nullptr,
+                [] (void *, int, sqlite3_changeset_iter *)
             {
-                if (isalnum (ch) || ch == '_')
-                    tmpStr += ch;
-                else if (ch == ',')
-                {
-                    if (!tmpStr.empty ())
-                        ret.push_back (tmpStr);
-                    tmpStr.clear ();
-                }
+                return SQLITE_CHANGESET_ABORT;
+            }, nullptr);
+            if (rc != SQLITE_OK)
+            {
+                DropChanges (changeMark);
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't apply changeset '") +
+                    sqlite3_errstr (rc) + "'");
             }
-            return ret;
-        };
+            NotifyChanges ();
+        }
+#endif  // SQLITE_ENABLE_SESSION
+
+        // Register a SQL Function
+        // - 'app' is Shared with other Connections, and Kept Alive
+        //   until this Connection is Closed
+        void CreateFunction (const std::string &name, int argc,
+            std::shared_ptr<void> app,
+            void (*func) (sqlite3_context *, int, sqlite3_value **),
+            void (*step) (sqlite3_context *, int, sqlite3_value **),
+            void (*final) (sqlite3_context *))
+        {
+            auto rc = sqlite3_create_function_v2 (db, name.c_str (), argc,
+                SQLITE_UTF8, app.get (), func, step, final, nullptr);
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't create function '") +
+                    sqlite3_errmsg (db) + "'");
+            extensions.push_back (std::move (app));
+        }
 
-    public:
-        // Checking Injection
-        template <typename T> class HasInjected
+        // Count of Functions and Modules Registered on this Connection
+        size_t ExtensionCount () const
         {
-            template <typename...> struct make_void { using type = void; };
-            template <typename... _Types>
-            using void_t = typename make_void<_Types...>::type;
+            return extensions.size ();
+        }
 
-            template <typename, typename = void_t<>>
-            struct Test : std::false_type {};
-            template <typename U>
-            struct Test <U, void_t<decltype (U::__TableName)>>
-                : std::true_type
-            {};
+        // Register a Virtual Table Module
+        // - 'aux' is Shared and Kept Alive as 'app' of Functions
+        // - A Name can be Registered only Once in a Connection
+        void CreateModule (const std::string &name,
+            const sqlite3_module *module, std::shared_ptr<void> aux)
+        {
+            auto rc = sqlite3_create_module_v2 (db, name.c_str (),
+                module, aux.get (), nullptr);
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't create module '") +
+                    sqlite3_errstr (rc) + "'");
+            extensions.push_back (std::move (aux));
+        }
 
-        public:
-            static constexpr bool value = Test<T>::value;
+        // Open 'column' of Row 'rowid' for Incremental I/O
+        sqlite3_blob *OpenBlob (const std::string &table,
+            const std::string &column, long long rowid, bool writable)
+        {
+            sqlite3_blob *blob = nullptr;
+            auto rc = sqlite3_blob_open (db, "main", table.c_str (),
+                column.c_str (), rowid, writable ? 1 : 0, &blob);
+            if (rc != SQLITE_OK)
+            {
+                auto errStr = std::string (
+                    "SQL error: Can't access blob '") +
+                    sqlite3_errmsg (db) + "'";
+                sqlite3_blob_close (blob);
+                throw std::runtime_error (errStr);
+            }
+            return blob;
+        }
 
-            static_assert (value, NO_ORMAP);
-        };
+        // Call 'hook (walFrames)' after each Commit in WAL Mode
+        // - Replace the Auto-checkpoint
+        //   (Restored to the Previous Setting if 'hook' is Empty)
+        void SetWalHook (std::function<void (int)> hook)
+        {
+            if (hook && !walHook)
+                ExecuteCallback ("PRAGMA wal_autocheckpoint;",
+                    [this] (int argc, char **argv)
+                {
+                    if (argc == 1 && argv[0] != nullptr)
+                        walAutoCheckpoint = std::atoi (argv[0]);
+                });
 
-        // Proxy Function
-        template <typename C, typename Fn>
-        static inline decltype (auto) Visit (C &obj, Fn fn)
+            walHook = std::move (hook);
+            if (walHook)
+                sqlite3_wal_hook (db, WalHook, this);
+            else
+                sqlite3_wal_autocheckpoint (db, walAutoCheckpoint);
+        }
+
+        // Checkpoint the WAL File in 'mode'
+        // - Return false if Blocked by other Connections
+        bool Checkpoint (int mode, int &walFrames, int &checkpointed)
         {
-            return obj.__Accept (fn);
+            // Read the Header to Know the File is in WAL Mode
+            Execute ("PRAGMA application_id;");
+
+            auto rc = sqlite3_wal_checkpoint_v2 (db, "main", mode,
+                &walFrames, &checkpointed);
+            if (rc == SQLITE_BUSY)
+                return false;
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't checkpoint '") +
+                    sqlite3_errmsg (db) + "'");
+            return true;
         }
 
-        // Field Name Proxy
-        template <typename C>
-        static inline const std::vector<std::string> &FieldNames (const C &)
+        // Copy the Database to 'fileName' Online
+        // - Copy 'pagesPerStep' Pages a Step, and Sleep between Steps
+        // - Call 'progress (remaining, total)' after each Step
+        void BackupTo (const std::string &fileName, int pagesPerStep,
+            std::chrono::milliseconds sleep,
+            const std::function<void (int, int)> &progress)
         {
-            static const auto fieldNames = ExtractFieldName (C::__FieldNames);
-            return fieldNames;
+            SQLConnector dest (fileName);
+            Copy (db, dest.db, pagesPerStep, sleep, progress);
         }
 
-        // Table Name Proxy
-        template <typename C>
-        static inline const std::string &TableName (const C &)
+        // Replace the Database by the Content of 'fileName'
+        void RestoreFrom (const std::string &fileName)
         {
-            static const std::string tableName { C::__TableName };
-            return tableName;
+            SQLConnector source (fileName);
+            ClearStatements ();
+            Copy (source.db, db, -1, std::chrono::milliseconds (0),
+                nullptr);
         }
-    };
 
-    // Unpacking Tricks :-)
-    // http://stackoverflow.com/questions/26902633/how-to-iterate-over-a-tuple-in-c-11/26902803#26902803
-    // - To avoid the unspecified order,
-    //   brace-enclosed initializer lists can be used,
-    //   which guarantee strict left-to-right order of evaluation.
-    // - To avoid the need for a not void return type,
-    //   the comma operator can be used to
-    //   always yield 1 in each expansion element.
+        // Copy the Committed Database to 'fileName' in One Step
+        // - Return false if in a Transaction
+        bool FlushTo (const std::string &fileName)
+        {
+            // Keep other Threads from Beginning a Transaction
+            std::unique_ptr<sqlite3_mutex, decltype (&sqlite3_mutex_leave)>
+                mutexGuard { sqlite3_db_mutex (db), sqlite3_mutex_leave };
+            sqlite3_mutex_enter (mutexGuard.get ());
 
-    using Expander = int[];
-}
+            if (InTransaction ())
+                return false;
+            BackupTo (fileName, -1, std::chrono::milliseconds (0),
+                nullptr);
+            return true;
+        }
 
-namespace BOT_ORM
-{
-    namespace Expression
-    {
-        // SetExpr
+        // Rows Modified since Connected
+        int TotalChanges () const
+        {
+            return sqlite3_total_changes (db);
+        }
 
-        struct SetExpr
+        // Schema Cookie, Changed by every Schema Change
+        // (which is NOT Counted by 'TotalChanges')
+        int SchemaVersion ()
         {
-            SetExpr (std::string field_op_val)
-                : _expr { std::move (field_op_val) }
-            {}
+            const std::string cmd = "PRAGMA schema_version;";
+            auto stmt = PrepareStatement (cmd);
+            std::unique_ptr<sqlite3_stmt, decltype (&sqlite3_finalize)>
+                stmtGuard { stmt, sqlite3_finalize };
+            if (sqlite3_step (stmt) != SQLITE_ROW)
+                throw std::runtime_error (std::string ("SQL error: '") +
+                    sqlite3_errmsg (db) + "' at '" + cmd + "'");
+            return sqlite3_column_int (stmt, 0);
+        }
 
-            const std::string &ToString () const
+        bool IsWalMode ()
+        {
+            std::string journalMode;
+            ExecuteCallback ("PRAGMA journal_mode;",
+                [&journalMode] (int argc, char **argv)
             {
-                return _expr;
+                if (argc == 1 && argv[0] != nullptr)
+                    journalMode = argv[0];
+            });
+            return journalMode == "wal";
+        }
+
+#ifdef SQLITE_ENABLE_SNAPSHOT
+        // Start a Read Transaction and Record its Snapshot
+        // - Keep the Transaction Open to Protect the Snapshot
+        //   from Checkpoints
+        sqlite3_snapshot *GetSnapshot ()
+        {
+            if (!IsWalMode ())
+                throw std::runtime_error (NOT_WAL_MODE);
+
+            Execute ("begin;");
+            ExecuteCallback ("select count(*) from sqlite_master;",
+                [] (int, char **) {});
+
+            sqlite3_snapshot *snapshot = nullptr;
+            auto rc = sqlite3_snapshot_get (db, "main", &snapshot);
+            if (rc != SQLITE_OK)
+            {
+                Execute ("rollback;");
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't get snapshot '") +
+                    sqlite3_errstr (rc) + "'");
             }
+            return snapshot;
+        }
 
-            inline SetExpr operator && (const SetExpr &rhs) const
+        // Start a Read Transaction on 'snapshot'
+        void OpenSnapshot (sqlite3_snapshot *snapshot)
+        {
+            // Read the Header to Know the File is in WAL Mode
+            Execute ("PRAGMA application_id;");
+            Execute ("begin;");
+
+            auto rc = sqlite3_snapshot_open (db, "main", snapshot);
+            if (rc != SQLITE_OK)
             {
-                return SetExpr { _expr + "," + rhs._expr };
+                Execute ("rollback;");
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't open snapshot '") +
+                    sqlite3_errstr (rc) + "'");
             }
+        }
+#endif  // SQLITE_ENABLE_SNAPSHOT
 
-        private:
-            std::string _expr;
-        };
+    private:
+        sqlite3 *db;
+        constexpr static size_t MAX_TRIAL = 16;
 
-        // Selectable
+        // VM Steps between Checks of Query Limits
+        constexpr static int PROGRESS_STEPS = 1000;
 
-        template <typename T>
-        struct Selectable
+        struct ProgressState
         {
-            std::string fieldName;
-            const std::string *tableName;
+            std::chrono::steady_clock::time_point deadline;
+            bool hasDeadline;
+            const std::atomic<bool> *cancelled;
+            bool timedOut;
 
-            Selectable (std::string _fieldName,
-                const std::string *_tableName)
-                : fieldName (std::move (_fieldName)), tableName (_tableName)
-            {}
+            // Limits of the Outer Query on this Connection
+            ProgressState *outer;
         };
 
-        // Field : Selectable
+        ProgressState *activeProgress = nullptr;
 
-        template <typename T>
-        struct Field : public Selectable<T>
-        {
-            Field (std::string _fieldName,
-                const std::string *_tableName)
-                : Selectable<T> (std::move (_fieldName), _tableName) {}
+        std::function<void (const BOT_ORM::QueryReport &)> queryListener;
+        bool adviseQuery = false;
+        bool throwOnIssue = false;
 
-            inline SetExpr operator = (T value)
-            {
-                std::ostringstream os;
-                BOT_ORM_Impl::SerializationHelper::
-                    Serialize (os << this->fieldName << "=", value);
-                return SetExpr { os.str () };
-            }
-        };
+        std::function<void (int)> walHook;
+        int walAutoCheckpoint = 1000;  // Default
 
-        // Nullable Field : Field : Selectable
+        // Data of Registered Functions and Modules
+        std::vector<std::shared_ptr<void>> extensions;
 
-        template <typename T>
-        struct NullableField : public Field<T>
-        {
-            NullableField (std::string _fieldName,
-                const std::string *_tableName)
-                : Field<T> (std::move (_fieldName), _tableName) {}
+        // Table -> Listeners of Changes
+        std::unordered_map<std::string, std::vector<
+            std::function<void (const BOT_ORM::RowChange &)>>>
+            changeListeners;
 
-            inline SetExpr operator = (T value)
-            {
-                std::ostringstream os;
-                BOT_ORM_Impl::SerializationHelper::
-                    Serialize (os << this->fieldName << "=", value);
-                return SetExpr { os.str () };
-            }
+        // Changes of the Current Transaction
+        std::vector<BOT_ORM::RowChange> changes;
+        bool committing = false;
 
-            inline SetExpr operator = (std::nullptr_t)
+        static void UpdateHook (void *param, int op, const char *,
+            const char *table, sqlite3_int64 rowid)
+        {
+            auto connector = static_cast<SQLConnector *> (param);
+            if (!connector->changeListeners.count (table))
+                return;
+
+            auto operation =
+                op == SQLITE_INSERT ? BOT_ORM::RowChange::Operation::Insert :
+                op == SQLITE_UPDATE ? BOT_ORM::RowChange::Operation::Update :
+                BOT_ORM::RowChange::Operation::Delete;
+            try
             {
-                return SetExpr { this->fieldName + "=null" };
+                connector->changes.push_back (
+                    BOT_ORM::RowChange { operation, table, rowid });
             }
-        };
+            catch (...) {}
+        }
 
-        // Aggregate Function : Selectable
+        static int CommitHook (void *param)
+        {
+            static_cast<SQLConnector *> (param)->committing = true;
+            return 0;
+        }
 
-        template <typename T>
-        struct Aggregate : public Selectable<T>
+        static void RollbackHook (void *param)
         {
-            Aggregate (std::string function)
-                : Selectable<T> (std::move (function), nullptr) {}
+            auto connector = static_cast<SQLConnector *> (param);
+            connector->changes.clear ();
+            connector->committing = false;
+        }
 
-            Aggregate (std::string function, const Field<T> &field)
-                : Selectable<T> (std::move (function) + "(" +
-                    *(field.tableName) + "." +
-                    field.fieldName + ")", nullptr)
-            {}
-        };
+        // Report the Changes if Committed
+        // (Called after each Succeeded Statement)
+        // - Every Listener is Called even if some of them Throw,
+        //   and the First Error is Rethrown afterwards
+        void NotifyChanges ()
+        {
+            if (!committing || InTransaction ())
+                return;
 
-        // Expr
+            committing = false;
+            auto committed = std::move (changes);
+            changes.clear ();
 
-        struct Expr
+            std::exception_ptr error;
+            for (const auto &change : committed)
+                for (const auto &listener :
+                    changeListeners.at (change.table))
+                {
+                    try
+                    {
+                        listener (change);
+                    }
+                    catch (...)
+                    {
+                        if (!error)
+                            error = std::current_exception ();
+                    }
+                }
+            if (error)
+                std::rethrow_exception (error);
+        }
+
+        // Drop the Changes of a Failed Statement since 'mark'
+        // (Rolled back by SQLite after Reported to 'UpdateHook')
+        void DropChanges (size_t mark)
         {
-            template <typename T>
-            Expr (const Selectable<T> &field, std::string op_val)
-                : _exprs { { field.fieldName + op_val, field.tableName } }
-            {}
+            if (changes.size () > mark)
+                changes.erase (changes.begin () + mark, changes.end ());
+        }
 
-            template <typename T>
-            Expr (const Selectable<T> &field, std::string op, T value)
-            {
-                std::ostringstream os;
-                BOT_ORM_Impl::SerializationHelper::
-                    Serialize (os << field.fieldName << op, value);
-                _exprs.emplace_back (os.str (), field.tableName);
+#ifdef SQLITE_ENABLE_SESSION
+        sqlite3_session *session = nullptr;
+        std::vector<std::string> sessionTables;
+
+        void OpenSession ()
+        {
+            CheckSession (sqlite3session_create (db, "main", &session));
+        }
+
+        void CheckSession (int rc)
+        {
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't record changes '") +
+                    sqlite3_errstr (rc) + "'");
+        }
+#endif  // SQLITE_ENABLE_SESSION
+
+        static int WalHook (void *param, sqlite3 *, const char *,
+            int walFrames)
+        {
+            try
+            {
+                static_cast<SQLConnector *> (param)->walHook (walFrames);
             }
+            catch (...) {}
+            return SQLITE_OK;
+        }
 
-            template <typename T>
-            Expr (const Field<T> &field1,
-                std::string op,
-                const Field<T> &field2)
-                : _exprs
+        std::unordered_map<StatementKey, sqlite3_stmt *,
+            StatementKeyHash> statements;
+
+        sqlite3_stmt *PrepareStatement (const std::string &cmd)
+        {
+            sqlite3_stmt *stmt = nullptr;
+            int rc = SQLITE_OK;
+
+            for (size_t iTry = 0; iTry < MAX_TRIAL; iTry++)
             {
-                { field1.fieldName, field1.tableName },
-                { std::move (op), nullptr },
-                { field2.fieldName, field2.tableName }
+                rc = sqlite3_prepare_v2 (db, cmd.c_str (), -1,
+                    &stmt, nullptr);
+                if (rc != SQLITE_BUSY)
+                    break;
+
+                std::this_thread::sleep_for (
+                    std::chrono::microseconds (20));
             }
-            {}
 
-            std::string ToString () const
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (std::string ("SQL error: '") +
+                    sqlite3_errmsg (db) + "' at '" + cmd + "'");
+            return stmt;
+        }
+
+        // Copy 'main' of 'source' to 'main' of 'dest' by 'sqlite3_backup'
+        // - Restart if 'source' is Written by other Connections
+        //   ('dest' is Updated in place if Written by 'source' itself)
+        static void Copy (sqlite3 *source, sqlite3 *dest,
+            int pagesPerStep, std::chrono::milliseconds sleep,
+            const std::function<void (int, int)> &progress)
+        {
+            std::unique_ptr<sqlite3_backup, decltype (&sqlite3_backup_finish)>
+                backup { sqlite3_backup_init (dest, "main", source, "main"),
+                sqlite3_backup_finish };
+            if (!backup)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't backup '") +
+                    sqlite3_errmsg (dest) + "'");
+
+            int rc = SQLITE_OK;
+            for (size_t iTry = 0; ; )
             {
-                std::ostringstream out;
-                for (const auto &expr : _exprs)
+                rc = sqlite3_backup_step (backup.get (), pagesPerStep);
+                if (rc == SQLITE_OK || rc == SQLITE_DONE)
                 {
-                    if (expr.second != nullptr)
-                        out << *(expr.second) << ".";
-                    out << expr.first;
+                    iTry = 0;
+                    if (progress)
+                        progress (sqlite3_backup_remaining (backup.get ()),
+                            sqlite3_backup_pagecount (backup.get ()));
+                    if (rc == SQLITE_DONE)
+                        break;
                 }
-                return out.str ();
+                else if ((rc != SQLITE_BUSY && rc != SQLITE_LOCKED) ||
+                    ++iTry >= MAX_TRIAL)
+                    break;
+
+                std::this_thread::sleep_for (
+                    sleep + std::chrono::microseconds (20));
             }
 
-            inline Expr operator && (const Expr &rhs) const
+            // Errors of Steps are NOT always Kept by 'finish'
+            auto finished = sqlite3_backup_finish (backup.release ());
+            rc = rc == SQLITE_DONE ? finished : rc;
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't backup '") +
+                    sqlite3_errstr (rc) + "'");
+        }
+
+        static int ResetStatement (sqlite3_stmt *stmt)
+        {
+            sqlite3_clear_bindings (stmt);
+            return sqlite3_reset (stmt);
+        }
+
+        // Same as 'ExecuteCallback' but Stepping the Statement Manually
+        // to Collect the Statistics
+        BOT_ORM::QueryStats ExecuteStatement (const std::string &cmd,
+            std::function<void (int, const ColumnValue *)> &callback,
+            const QueryLimits &limits)
+        {
+            ProgressState progress {
+                std::chrono::steady_clock::now () + limits.timeout,
+                limits.timeout.count () > 0,
+                limits.cancelled.get (),
+                false,
+                activeProgress
+            };
+            if (progress.cancelled && *progress.cancelled)
+                throw BOT_ORM::QueryInterrupted (
+                    std::string ("SQL error: '") + QUERY_CANCELLED +
+                    "' at '" + cmd + "'", false);
+
+            auto stmt = PrepareStatement (cmd);
+            std::unique_ptr<sqlite3_stmt, decltype (&sqlite3_finalize)>
+                stmtGuard { stmt, sqlite3_finalize };
+
+            // Same as 'sqlite3_interrupt' when Limits are Exceeded
+            // - Limits of the Outer Query (e.g. Querying in a Listener)
+            //   are still Checked, and its Handler is Restored afterwards
+            auto restoreOuter = [this] (ProgressState *state)
             {
-                return And_Or (rhs, " and ");
-            }
-            inline Expr operator || (const Expr &rhs) const
+                activeProgress = state->outer;
+                if (activeProgress)
+                    sqlite3_progress_handler (db, PROGRESS_STEPS,
+                        ProgressHandler, activeProgress);
+                else
+                    sqlite3_progress_handler (db, 0, nullptr, nullptr);
+            };
+            std::unique_ptr<ProgressState, decltype (restoreOuter)>
+                progressGuard { nullptr, restoreOuter };
+            if (progress.hasDeadline || progress.cancelled)
             {
-                return And_Or (rhs, " or ");
+                sqlite3_progress_handler (db, PROGRESS_STEPS,
+                    ProgressHandler, &progress);
+                activeProgress = &progress;
+                progressGuard.reset (&progress);
             }
 
-        private:
-            std::list<std::pair<std::string, const std::string *>> _exprs;
+            int rc = SQLITE_OK;
 
-            Expr And_Or (const Expr &rhs, std::string logOp) const
+            std::vector<ColumnValue> columns;
+            std::vector<std::string> texts;
+            auto decompressed = 0;
+            auto decompressTime = std::chrono::steady_clock::duration {};
+            auto anyRow = false;
+            for (size_t iTry = 0; ; )
             {
-                auto ret = *this;
-                auto rigthExprs = rhs._exprs;
-                ret._exprs.emplace_front ("(", nullptr);
-                ret._exprs.emplace_back (std::move (logOp), nullptr);
-                ret._exprs.splice (ret._exprs.cend (),
-                    std::move (rigthExprs));
-                ret._exprs.emplace_back (")", nullptr);
-                return ret;
-            }
-        };
+                rc = sqlite3_step (stmt);
+                if (rc == SQLITE_ROW)
+                {
+                    anyRow = true;
+                    auto argc = sqlite3_column_count (stmt);
+                    columns.resize (argc);
+                    texts.resize (argc);
+                    for (int i = 0; i < argc; i++)
+                    {
+                        columns[i] = ColumnValue { stmt, i, nullptr };
+
+                        // Compressed Fields are Decompressed here
+                        // (Only the Retrieved Columns)
+                        if (!IsCompressed (stmt, i))
+                            continue;
+
+                        auto start = std::chrono::steady_clock::now ();
+                        if (!LZCodec::Decompress (
+                            static_cast<const char *> (
+                                sqlite3_column_blob (stmt, i)),
+                            (size_t) sqlite3_column_bytes (stmt, i),
+                            texts[i]))
+                            throw std::runtime_error (
+                                std::string ("SQL error: '") +
+                                BAD_COMPRESSED + "' at '" + cmd + "'");
+                        decompressTime +=
+                            std::chrono::steady_clock::now () - start;
+                        decompressed++;
+                        columns[i].text = &texts[i];
+                    }
 
-        // Field / Aggregate ? Value
+                    try
+                    {
+                        callback (argc, columns.data ());
+                    }
+                    catch (const std::exception &ex)
+                    {
+                        throw std::runtime_error (
+                            std::string ("SQL error: '") + ex.what () +
+                            "' at '" + cmd + "'");
+                    }
+                }
+                else if (rc == SQLITE_BUSY && !anyRow &&
+                    ++iTry < MAX_TRIAL)
+                {
+                    sqlite3_reset (stmt);
+                    std::this_thread::sleep_for (
+                        std::chrono::microseconds (20));
+                }
+                else
+                    break;
+            }
 
-        template <typename T>
-        inline Expr operator == (const Selectable<T> &op, T value)
-        {
-            return Expr (op, "=", std::move (value));
+            if (rc == SQLITE_INTERRUPT && activeProgress)
+            {
+                auto timedOut = false;
+                for (auto state = activeProgress; state != nullptr;
+                    state = state->outer)
+                    timedOut = timedOut || state->timedOut;
+                throw BOT_ORM::QueryInterrupted (
+                    std::string ("SQL error: '") +
+                    (timedOut ? QUERY_TIMEOUT : QUERY_CANCELLED) +
+                    "' at '" + cmd + "'", timedOut);
+            }
+            if (rc != SQLITE_DONE)
+                throw std::runtime_error (std::string ("SQL error: '") +
+                    sqlite3_errmsg (db) + "' at '" + cmd + "'");
+
+            return BOT_ORM::QueryStats {
+                sqlite3_stmt_status (stmt,
+                    SQLITE_STMTSTATUS_FULLSCAN_STEP, 0),
+                sqlite3_stmt_status (stmt,
+                    SQLITE_STMTSTATUS_SORT, 0),
+                sqlite3_stmt_status (stmt,
+                    SQLITE_STMTSTATUS_AUTOINDEX, 0),
+                sqlite3_stmt_status (stmt,
+                    SQLITE_STMTSTATUS_VM_STEP, 0),
+                decompressed,
+                std::chrono::duration_cast<std::chrono::microseconds> (
+                    decompressTime)
+            };
         }
 
-        template <typename T>
-        inline Expr operator != (const Selectable<T> &op, T value)
+    public:
+        // Column of a Compressed Field Stored Compressed
+        static bool IsCompressed (sqlite3_stmt *stmt, int index)
         {
-            return Expr (op, "!=", std::move (value));
+            if (sqlite3_column_type (stmt, index) != SQLITE_BLOB)
+                return false;
+            auto declType = sqlite3_column_decltype (stmt, index);
+            return declType && std::strstr (declType, "compressed");
         }
 
-        template <typename T>
-        inline Expr operator > (const Selectable<T> &op, T value)
+        // Compress the Value of a Compressed Field into 'out'
+        // - Return false if it should be Stored as it is
+        bool Compress (const std::string &value, std::string &out)
         {
-            return Expr (op, ">", std::move (value));
+            auto start = std::chrono::steady_clock::now ();
+            auto smaller = value.size () >= MIN_COMPRESS_SIZE &&
+                LZCodec::Compress (value.data (), value.size (), out);
+            auto elapsed = std::chrono::duration_cast<
+                std::chrono::microseconds> (
+                    std::chrono::steady_clock::now () - start);
+
+            compression.values++;
+            compression.compressed += smaller ? 1 : 0;
+            compression.rawBytes += value.size ();
+            compression.storedBytes += smaller ? out.size () : value.size ();
+            compression.compressTime += elapsed;
+            return smaller;
         }
 
-        template <typename T>
-        inline Expr operator >= (const Selectable<T> &op, T value)
+        const BOT_ORM::CompressionStats &CompressionMetrics () const
         {
-            return Expr (op, ">=", std::move (value));
+            return compression;
         }
 
-        template <typename T>
-        inline Expr operator < (const Selectable<T> &op, T value)
+    private:
+        // Short Values are NOT Compressed
+        constexpr static size_t MIN_COMPRESS_SIZE = 64;
+
+        BOT_ORM::CompressionStats compression {};
+
+        static int ProgressHandler (void *param)
         {
-            return Expr (op, "<", std::move (value));
+            for (auto state = static_cast<ProgressState *> (param);
+                state != nullptr; state = state->outer)
+            {
+                if (state->cancelled && *state->cancelled)
+                    return 1;
+                if (state->hasDeadline &&
+                    std::chrono::steady_clock::now () >= state->deadline)
+                {
+                    state->timedOut = true;
+                    return 1;
+                }
+            }
+            return 0;
         }
 
-        template <typename T>
-        inline Expr operator <= (const Selectable<T> &op, T value)
+        static int CallbackWrapper (
+            void *callbackParam, int argc, char **argv, char **)
         {
-            return Expr (op, "<=", std::move (value));
+            auto pParam = static_cast<std::pair<
+                std::function<void (int, char **)> *,
+                std::string
+            >*>(callbackParam);
+
+            try
+            {
+                pParam->first->operator()(argc, argv);
+                return 0;
+            }
+            catch (const std::exception &ex)
+            {
+                pParam->second = ex.what ();
+                return 1;
+            }
         }
+    };
 
-        // Field ? Field
+    // Functions and Modules Registered by an ORMapper
+    // - Registered on its Connection, and Replayed in Order on
+    //   every Pooled Connection (before it is Acquired)
 
-        template <typename T>
-        inline Expr operator == (const Field<T> &op1, const Field<T> &op2)
+    class Extensions
+    {
+    public:
+        // Register on 'connector' first (Dropped if Failed)
+        void AddFunction (std::string name, int argc,
+            std::shared_ptr<void> app,
+            void (*func) (sqlite3_context *, int, sqlite3_value **),
+            void (*step) (sqlite3_context *, int, sqlite3_value **),
+            void (*final) (sqlite3_context *),
+            SQLConnector &connector)
         {
-            return Expr { op1 , "=", op2 };
+            Add ([=] (SQLConnector &target)
+            {
+                target.CreateFunction (name, argc, app, func, step, final);
+            }, connector);
         }
 
-        template <typename T>
-        inline Expr operator != (const Field<T> &op1, const Field<T> &op2)
+        void AddModule (std::string name, const sqlite3_module *module,
+            std::shared_ptr<void> aux, SQLConnector &connector)
         {
-            return Expr { op1, "!=", op2 };
+            Add ([=] (SQLConnector &target)
+            {
+                target.CreateModule (name, module, aux);
+            }, connector);
+
+            std::lock_guard<std::mutex> lock (mtx);
+            modules[std::move (name)] = std::make_pair (module, aux.get ());
         }
 
-        template <typename T>
-        inline Expr operator > (const Field<T> &op1, const Field<T> &op2)
+        // Get 'aux' of a Module Registered as 'name'
+        // (nullptr if None or NOT of 'module')
+        void *FindModule (const std::string &name,
+            const sqlite3_module *module)
         {
-            return Expr { op1 , ">", op2 };
+            std::lock_guard<std::mutex> lock (mtx);
+            auto it = modules.find (name);
+            return it != modules.end () && it->second.first == module
+                ? it->second.second : nullptr;
         }
 
-        template <typename T>
-        inline Expr operator >= (const Field<T> &op1, const Field<T> &op2)
+        // Register the Entries NOT on 'connector' yet
+        void ApplyTo (SQLConnector &connector)
         {
-            return Expr { op1, ">=", op2 };
+            std::lock_guard<std::mutex> lock (mtx);
+            Replay (connector);
         }
 
-        template <typename T>
-        inline Expr operator < (const Field<T> &op1, const Field<T> &op2)
+    private:
+        std::mutex mtx;
+        std::vector<std::function<void (SQLConnector &)>> entries;
+
+        // Module Name -> Module and 'aux' of Virtual Tables
+        std::unordered_map<std::string,
+            std::pair<const sqlite3_module *, void *>> modules;
+
+        void Add (std::function<void (SQLConnector &)> entry,
+            SQLConnector &connector)
         {
-            return Expr { op1 , "<", op2 };
+            std::lock_guard<std::mutex> lock (mtx);
+            entries.push_back (std::move (entry));
+            try
+            {
+                Replay (connector);
+            }
+            catch (...)
+            {
+                entries.pop_back ();
+                throw;
+            }
         }
 
-        template <typename T>
-        inline Expr operator <= (const Field<T> &op1, const Field<T> &op2)
+        // Each Entry Registers One Function or Module
+        void Replay (SQLConnector &connector)
         {
-            return Expr { op1, "<=", op2 };
+            for (auto i = connector.ExtensionCount ();
+                i < entries.size (); i++)
+                entries[i] (connector);
         }
+    };
 
-        // Nullable Field == / != nullptr
+    // Pool of Read Connections to a Database File
+    // - Reuse the Connections of Parallel Scans
+    // - Pin every Connection to the Same Snapshot if 'pinSnapshot'
+    //   (Connections stay in their Read Transactions until the Pool
+    //   is Destroyed)
+    // - Or 'Pin' a Pool Borrowing the Connections for a single Scan
+    // - Register the Functions and Modules of 'extensions'
+    //   on the Connections
 
-        template <typename T>
-        inline Expr operator == (const NullableField<T> &op, std::nullptr_t)
+    class ReaderPool : public std::enable_shared_from_this<ReaderPool>
+    {
+    public:
+        ReaderPool (std::string fileName,
+            std::shared_ptr<Extensions> extensions = nullptr,
+            bool pinSnapshot = false)
+            : fileName (std::move (fileName)),
+            extensions (std::move (extensions)), snapshot (nullptr)
         {
-            return Expr { op, " is null" };
+#ifdef SQLITE_ENABLE_SNAPSHOT
+            if (!pinSnapshot)
+                return;
+
+            std::unique_ptr<SQLConnector> reader (
+                new SQLConnector (this->fileName));
+            snapshot = reader->GetSnapshot ();
+            idle.push_back (std::move (reader));
+#else
+            (void) pinSnapshot;
+#endif  // SQLITE_ENABLE_SNAPSHOT
         }
 
-        template <typename T>
-        inline Expr operator != (const NullableField<T> &op, std::nullptr_t)
+        ~ReaderPool ()
         {
-            return Expr { op, " is not null" };
+            // Return Borrowed Connections out of their Transactions
+            if (parent)
+                for (auto &reader : idle)
+                {
+                    try
+                    {
+                        if (reader->InTransaction ())
+                            reader->Execute ("rollback;");
+                        parent->Return (std::move (reader));
+                    }
+                    catch (...) {}
+                }
+            idle.clear ();
+#ifdef SQLITE_ENABLE_SNAPSHOT
+            if (snapshot)
+                sqlite3_snapshot_free (snapshot);
+#endif  // SQLITE_ENABLE_SNAPSHOT
         }
 
-        // String Field & / | std::string
-
-        inline Expr operator & (const Field<std::string> &field,
-            std::string val)
+        bool IsPinned () const
         {
-            return Expr (field, " like ", std::move (val));
+            return snapshot != nullptr;
         }
 
-        inline Expr operator | (const Field<std::string> &field,
-            std::string val)
+        // Pin a Pool to the Current Snapshot
+        // - Borrow the Connections of this Pool
+        // - nullptr if the Database is NOT in WAL Mode
+        std::shared_ptr<ReaderPool> Pin ()
         {
-            return Expr (field, " not like ", std::move (val));
-        }
+#ifdef SQLITE_ENABLE_SNAPSHOT
+            auto reader = Take ();
+            if (!reader->IsWalMode ())
+            {
+                Return (std::move (reader));
+                return nullptr;
+            }
 
-        // Aggregate Function Helpers
+            auto pinned = std::make_shared<ReaderPool> (
+                fileName, extensions);
+            pinned->parent = shared_from_this ();
+            pinned->snapshot = reader->GetSnapshot ();
+            pinned->idle.push_back (std::move (reader));
+            return pinned;
+#else
+            return nullptr;
+#endif  // SQLITE_ENABLE_SNAPSHOT
+        }
 
-        inline auto Count ()
+        // Get an Idle Connection (or Open a new one)
+        // - Returned to the Pool when Released
+        std::shared_ptr<SQLConnector> Acquire ()
         {
-            return Aggregate<size_t> { "count (*)" };
+            std::unique_ptr<SQLConnector> reader;
+            {
+                std::lock_guard<std::mutex> lock (mtx);
+                if (!idle.empty ())
+                {
+                    reader = std::move (idle.back ());
+                    idle.pop_back ();
+                }
+            }
+
+            if (!reader)
+            {
+                reader = parent ? parent->Take () :
+                    std::unique_ptr<SQLConnector> (
+                        new SQLConnector (fileName));
+#ifdef SQLITE_ENABLE_SNAPSHOT
+                if (snapshot)
+                    reader->OpenSnapshot (snapshot);
+#endif  // SQLITE_ENABLE_SNAPSHOT
+            }
+            if (extensions)
+                extensions->ApplyTo (*reader);
+
+            auto pool = shared_from_this ();
+            return std::shared_ptr<SQLConnector> (reader.release (),
+                [pool] (SQLConnector *released)
+            {
+                pool->Return (std::unique_ptr<SQLConnector> (released));
+            });
         }
 
-        template <typename T>
-        inline auto Count (const Field<T> &field)
+    private:
+        std::string fileName;
+        std::shared_ptr<Extensions> extensions;
+        sqlite3_snapshot *snapshot;
+
+        // Pool Lending the Connections (of a Pinned Pool)
+        std::shared_ptr<ReaderPool> parent;
+
+        std::mutex mtx;
+        std::vector<std::unique_ptr<SQLConnector>> idle;
+
+        std::unique_ptr<SQLConnector> Take ()
         {
-            return Aggregate<T> { "count", field };
+            {
+                std::lock_guard<std::mutex> lock (mtx);
+                if (!idle.empty ())
+                {
+                    auto reader = std::move (idle.back ());
+                    idle.pop_back ();
+                    return reader;
+                }
+            }
+            return std::unique_ptr<SQLConnector> (
+                new SQLConnector (fileName));
         }
 
-        template <typename T>
-        inline auto Sum (const Field<T> &field)
+        void Return (std::unique_ptr<SQLConnector> reader)
         {
-            return Aggregate<T> { "sum", field };
+            std::lock_guard<std::mutex> lock (mtx);
+            idle.push_back (std::move (reader));
         }
+    };
 
-        template <typename T>
-        inline auto Avg (const Field<T> &field)
+    // Write-behind of an In-memory Database to 'fileName'
+    // - Flush every 'interval' if Rows or Schema are Modified
+    //   (and at the End)
+    // - Skip the Flush in a Transaction until the Next 'interval'
+
+    class Flusher
+    {
+    public:
+        Flusher (std::shared_ptr<SQLConnector> connector,
+            std::string fileName, std::chrono::milliseconds interval)
+            : connector (std::move (connector)),
+            fileName (std::move (fileName)), interval (interval)
         {
-            return Aggregate<T> { "avg", field };
+            this->connector->RestoreFrom (this->fileName);
+            flushedChanges = this->connector->TotalChanges ();
+            flushedSchema = this->connector->SchemaVersion ();
+            worker = std::thread ([this] { Run (); });
         }
 
-        template <typename T>
-        inline auto Max (const Field<T> &field)
+        ~Flusher ()
         {
-            return Aggregate<T> { "max", field };
+            {
+                std::lock_guard<std::mutex> lock (mtx);
+                stopped = true;
+            }
+            signal.notify_one ();
+            worker.join ();
+
+            try
+            {
+                Flush ();
+            }
+            catch (...) {}
         }
 
-        template <typename T>
-        inline auto Min (const Field<T> &field)
+        bool Flush ()
         {
-            return Aggregate<T> { "min", field };
+            std::lock_guard<std::mutex> lock (flushMtx);
+            auto changes = connector->TotalChanges ();
+            auto schema = connector->SchemaVersion ();
+            if (!connector->FlushTo (fileName))
+                return false;
+            flushedChanges = changes;
+            flushedSchema = schema;
+            return true;
         }
-    }
 
-    class ORMapper;
+    private:
+        std::shared_ptr<SQLConnector> connector;
+        const std::string fileName;
+        const std::chrono::milliseconds interval;
 
-    class Constraint
-    {
-    protected:
-        std::string constraint;
-        std::string field;
+        std::mutex mtx;
+        std::condition_variable signal;
+        std::thread worker;
+        bool stopped = false;
 
-        Constraint (std::string &&_constraint,
-            std::string _field = std::string {})
-            : constraint (_constraint), field (std::move (_field))
-        {}
-
-        friend class ORMapper;
+        // Serialize Flushes of the Worker and 'Flush'
+        std::mutex flushMtx;
+        std::atomic<int> flushedChanges;
+        std::atomic<int> flushedSchema;
 
-    public:
-        struct CompositeField
+        void Run ()
         {
-            std::string fieldName;
-            const std::string *tableName;
-
-            template <typename... Fields>
-            CompositeField (const Fields & ... args)
-                : tableName (nullptr)
+            std::unique_lock<std::mutex> lock (mtx);
+            while (!signal.wait_for (lock, interval,
+                [this] { return stopped; }))
             {
-                (void) BOT_ORM_Impl::Expander
+                lock.unlock ();
+                try
                 {
-                    0, (Extract (args), 0)...
-                };
+                    if (connector->TotalChanges () != flushedChanges ||
+                        connector->SchemaVersion () != flushedSchema)
+                        Flush ();
+                }
+                catch (...) {}  // Retry at the Next 'interval'
+                lock.lock ();
             }
+        }
+    };
 
-        private:
-            template <typename T>
-            void Extract (const Expression::Field<T> &field)
-            {
-                if (tableName != nullptr && tableName != field.tableName)
-                    throw std::runtime_error (NOT_SAME_TABLE);
-                tableName = field.tableName;
-                if (fieldName.empty ())
-                    fieldName = field.fieldName;
-                else
-                    fieldName = field.fieldName + "," + fieldName;
-            }
-        };
+    // Background Checkpoints on a Separate Connection
+    // - PASSIVE when a Commit leaves 'walFrames' Frames in the WAL File
+    //   (instead of the Auto-checkpoint inside the Committing Writer),
+    //   or when 'interval' Elapses after Commits
+    // - TRUNCATE when NO Commit in the Last 'interval'
 
-        template <typename T>
-        static inline Constraint Default (
-            const Expression::Field<T> &field,
-            const T &value)
+    class Checkpointer
+    {
+    public:
+        Checkpointer (std::shared_ptr<SQLConnector> writer,
+            std::chrono::milliseconds interval, int walFrames)
+            : writer (std::move (writer)),
+            checkpointer (this->writer->FileName ()),
+            interval (interval), walFrames (walFrames),
+            stats {}
         {
-            std::ostringstream os;
-            BOT_ORM_Impl::SerializationHelper::
-                Serialize (os << " default ", value);
-            return Constraint { os.str (), field.fieldName };
+            this->writer->SetWalHook ([this] (int frames)
+            {
+                std::lock_guard<std::mutex> lock (mtx);
+                commits++;
+                if (frames >= this->walFrames)
+                {
+                    pending = true;
+                    signal.notify_one ();
+                }
+            });
+            worker = std::thread ([this] { Run (); });
         }
 
-        static inline Constraint Check (
-            const Expression::Expr &expr)
+        ~Checkpointer ()
         {
-            return Constraint { "check (" + expr.ToString () + ")" };
+            writer->SetWalHook (nullptr);
+            {
+                std::lock_guard<std::mutex> lock (mtx);
+                stopped = true;
+            }
+            signal.notify_one ();
+            worker.join ();
         }
 
-        template <typename T>
-        static inline Constraint Unique (
-            const Expression::Field<T> &field)
+        BOT_ORM::CheckpointStats Stats ()
         {
-            return Constraint { "unique (" + field.fieldName + ")" };
+            std::lock_guard<std::mutex> lock (mtx);
+            return stats;
         }
 
-        static inline Constraint Unique (
-            const CompositeField &fields)
-        {
-            return Constraint { "unique (" + fields.fieldName + ")" };
-        }
+    private:
+        std::shared_ptr<SQLConnector> writer;
+        SQLConnector checkpointer;
 
-        template <typename T>
-        static inline Constraint Reference (
-            const Expression::Field<T> &field,
-            const Expression::Field<T> &refered)
+        const std::chrono::milliseconds interval;
+        const int walFrames;
+
+        std::mutex mtx;
+        std::condition_variable signal;
+        std::thread worker;
+
+        bool stopped = false;
+        bool pending = false;
+        size_t commits = 0;
+
+        // Frames Checkpointed of the Current WAL File
+        int lastCheckpointed = 0;
+
+        BOT_ORM::CheckpointStats stats;
+
+        void Run ()
         {
-            return Constraint {
-                std::string ("foreign key (") + field.fieldName +
-                ") references " + *(refered.tableName) +
-                "(" + refered.fieldName + ")" };
+            std::unique_lock<std::mutex> lock (mtx);
+            while (!stopped)
+            {
+                auto signaled = signal.wait_for (lock, interval,
+                    [this] { return stopped || pending; });
+                if (stopped)
+                    break;
+
+                auto truncate = !signaled && commits == 0;
+                if (truncate && stats.walFrames == 0)
+                    continue;  // Nothing to Truncate
+
+                pending = false;
+                commits = 0;
+                lock.unlock ();
+                Checkpoint (truncate);
+                lock.lock ();
+            }
         }
 
-        static inline Constraint Reference (
-            const CompositeField &field,
-            const CompositeField &refered)
+        void Checkpoint (bool truncate)
         {
-            return Constraint {
-                std::string ("foreign key (") + field.fieldName +
-                ") references " + *(refered.tableName) +
-                "(" + refered.fieldName + ")" };
+            int frames = 0, checkpointed = 0;
+            std::string error;
+
+            auto start = std::chrono::steady_clock::now ();
+            auto done = false;
+            try
+            {
+                done = checkpointer.Checkpoint (truncate
+                    ? SQLITE_CHECKPOINT_TRUNCATE
+                    : SQLITE_CHECKPOINT_PASSIVE,
+                    frames, checkpointed);
+            }
+            catch (const std::exception &ex)
+            {
+                error = ex.what ();
+            }
+            auto elapsed = std::chrono::duration_cast<
+                std::chrono::microseconds> (
+                    std::chrono::steady_clock::now () - start);
+
+            // -1 if NOT in WAL Mode
+            frames = std::max (frames, 0);
+            checkpointed = std::max (checkpointed, 0);
+
+            std::lock_guard<std::mutex> lock (mtx);
+            stats.elapsed += elapsed;
+            if (!error.empty ())
+            {
+                stats.lastError = std::move (error);
+                return;
+            }
+            if (!done)
+                return;
+
+            // No Commit since the Last Run before Truncation
+            if (truncate)
+            {
+                stats.framesCheckpointed +=
+                    std::max (stats.walFrames - lastCheckpointed, 0);
+                stats.walFrames = 0;
+                stats.truncations++;
+                lastCheckpointed = 0;
+                return;
+            }
+
+            // The WAL File was Reset by a Writer
+            if (checkpointed < lastCheckpointed)
+                lastCheckpointed = 0;
+            stats.framesCheckpointed += checkpointed - lastCheckpointed;
+            stats.walFrames = frames;
+            stats.checkpoints++;
+            lastCheckpointed = checkpointed;
         }
     };
 
+    // Helper - Field Type Checker
+
     template <typename T>
-    class Queryable;
-}
+    struct TypeString
+    {
+        constexpr static const char *typeStr =
+            (std::is_integral<T>::value &&
+                !std::is_same<T, char>::value &&
+                !std::is_same<T, wchar_t>::value &&
+                !std::is_same<T, char16_t>::value &&
+                !std::is_same<T, char32_t>::value &&
+                !std::is_same<T, unsigned char>::value)
+            ? " integer not null"
+            : (std::is_floating_point<T>::value)
+            ? " real not null"
+            : (std::is_same<T, std::string>::value)
+            ? " text not null"
+            : (std::is_same<T, BOT_ORM::Blob>::value ||
+                std::is_same<T, BOT_ORM::BlobView>::value)
+            ? " blob not null"
+            : nullptr;
 
-namespace BOT_ORM_Impl
-{
-    // Why Remove QueryableHelper from Query?
-    // Query is a template but the Helper can be shared
+        static_assert (typeStr != nullptr, BAD_TYPE);
+    };
 
-    class QueryableHelper
+    template <typename T>
+    struct TypeString <BOT_ORM::Nullable<T>>
     {
-        template <typename T>
-        using Nullable = BOT_ORM::Nullable<T>;
-
-        template <typename T>
-        using Selectable = BOT_ORM::Expression::Selectable<T>;
+        constexpr static const char *typeStr =
+            (std::is_integral<T>::value &&
+                !std::is_same<T, char>::value &&
+                !std::is_same<T, wchar_t>::value &&
+                !std::is_same<T, char16_t>::value &&
+                !std::is_same<T, char32_t>::value &&
+                !std::is_same<T, unsigned char>::value)
+            ? " integer"
+            : (std::is_floating_point<T>::value)
+            ? " real"
+            : (std::is_same<T, std::string>::value)
+            ? " text"
+            : (std::is_same<T, BOT_ORM::Blob>::value ||
+                std::is_same<T, BOT_ORM::BlobView>::value)
+            ? " blob"
+            : nullptr;
 
-    protected:
-        template <typename T>
-        friend class BOT_ORM::Queryable;
+        static_assert (typeStr != nullptr, BAD_TYPE);
+    };
 
-        // #1 Tuple Visitor
+    // SQL Writer
+    // - Append SQL Text to a single Buffer (instead of 'std::ostringstream')
+    // - Format Numbers without Locale
+    //   (Floating Points in the Shortest Form that Round-trips)
 
-        // Apply 'Fn' to each of element of Tuple
-        template <typename Fn, typename TupleType, std::size_t... I>
-        static inline void TupleVisit_Impl (
-            TupleType &tuple, Fn fn, std::index_sequence<I...>)
+    class SQLWriter
+    {
+    public:
+        SQLWriter &operator << (const std::string &str)
         {
-            (void) BOT_ORM_Impl::Expander
-            {
-                0, ((void) fn (std::get<I> (tuple)), 0)...
-            };
+            buffer += str;
+            return *this;
         }
 
-        // Produce the 'index_sequence' for 'tuple'
-        template <typename Fn, typename TupleType>
-        static inline void TupleVisit (TupleType &tuple, Fn fn)
+        SQLWriter &operator << (const char *str)
         {
-            constexpr auto size = std::tuple_size<TupleType>::value;
-            return TupleVisit_Impl (tuple, fn,
-                std::make_index_sequence<size> {});
+            buffer += str;
+            return *this;
         }
 
-        // #2 Join To Tuple
+        SQLWriter &operator << (char ch)
+        {
+            buffer += ch;
+            return *this;
+        }
 
-        // Type To Nullable
-        // Get Nullable Type Wrappers for Non-nullable Types
-        template <typename T> struct TypeToNullable
+        SQLWriter &operator << (bool value)
         {
-            using type = Nullable<T>;
-        };
-        template <typename T> struct TypeToNullable <Nullable<T>>
+            buffer += value ? '1' : '0';
+            return *this;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_integral<T>::value, SQLWriter &>
+            operator << (T value)
         {
-            using type = Nullable<T>;
-        };
+            using U = std::make_unsigned_t<T>;
 
-        // Fields To Nullable
-        // Apply 'TypeToNullable' to each element of Fields
-        template <typename... Args>
-        static inline auto FieldsToNullable (Args...)
+            char buf[24];
+            char *end = buf + sizeof (buf), *begin = end;
+            auto negative = std::is_signed<T>::value && value < T (0);
+            auto magnitude = negative ? U (U (0) - U (value)) : U (value);
+            do
+            {
+                *--begin = char ('0' + magnitude % 10);
+                magnitude /= 10;
+            } while (magnitude != 0);
+            if (negative)
+                *--begin = '-';
+
+            buffer.append (begin, end);
+            return *this;
+        }
+
+        template <typename T>
+        std::enable_if_t<std::is_floating_point<T>::value, SQLWriter &>
+            operator << (T value)
         {
-            // Unpacking Tricks :-)
-            // Expand each of 'Args'
-            // with 'TypeToNullable_t<...>' as a sequence
-            return std::tuple<
-                typename TypeToNullable<Args>::type...
-            > {};
+            // No Literal for NaN and Infinity in SQLite
+            if (value != value)
+                buffer += "null";
+            else if (value > std::numeric_limits<T>::max ())
+                buffer += "9e999";
+            else if (value < std::numeric_limits<T>::lowest ())
+                buffer += "-9e999";
+            else
+                WriteFloat (value);
+            return *this;
         }
 
-        // QueryResult To Nullable
-        template <typename C>
-        static inline auto QueryResultToTuple (const C &arg)
+        // String Literal with Quotes Escaped
+        SQLWriter &Quote (const std::string &str)
         {
-            return BOT_ORM_Impl::InjectionHelper::Visit (
-                arg, [] (auto ... args)
+            buffer += '\'';
+            for (auto ch : str)
             {
-                return FieldsToNullable (args...);
-            });
+                if (ch == '\'')
+                    buffer += '\'';
+                buffer += ch;
+            }
+            buffer += '\'';
+            return *this;
         }
 
-        template <typename... Args>
-        static inline auto QueryResultToTuple (
-            const std::tuple<Args...>& t)
+        SQLWriter &Write (const char *str, size_t size)
         {
-            // FieldsToNullable is not necessary: Nullable already
-            return t;
+            buffer.append (str, size);
+            return *this;
         }
 
-        // Construct Tuple from QueryResult List
-        template <typename... Args>
-        static inline auto JoinToTuple (const Args & ... args)
+        // Bytes in Hex Digits
+        SQLWriter &Hex (const void *data, size_t size)
         {
-            // Unpacking Tricks :-)
-            return decltype (std::tuple_cat (
-                QueryResultToTuple (args)...
-            )) {};
+            AppendHex (buffer, data, size);
+            return *this;
         }
 
-        // #3 Select To Tuple
+        bool Empty () const { return buffer.empty (); }
+        char Back () const { return buffer.back (); }
 
-        // Selectable To Tuple
-        template <typename T>
-        static inline auto SelectableToTuple (const Selectable<T> &)
+        // Drop the Trailing Separator
+        void PopBack () { buffer.pop_back (); }
+
+        // Keep the Capacity for Reuse
+        void Clear () { buffer.clear (); }
+
+        const std::string &Str () const { return buffer; }
+        std::string Release ()
         {
-            // Notes: Only 'const Selectable<T> &' will overload...
-            return Nullable<T> {};
+            std::string ret;
+            ret.swap (buffer);
+            return ret;
         }
 
-        // Construct Tuple from Selectable<T> List
-        template <typename... Args>
-        static inline auto SelectToTuple (const Args & ... args)
+    private:
+        std::string buffer;
+
+        template <typename T>
+        void WriteFloat (T value)
         {
-            // Unpacking Tricks :-)
-            return std::tuple <
-                decltype (SelectableToTuple (args))...
-            > {};
+            char buf[64];
+            int len = 0;
+            for (auto precision = std::numeric_limits<T>::digits10;
+                 precision <= std::numeric_limits<T>::max_digits10;
+                 precision++)
+            {
+                len = Format (buf, sizeof (buf), precision, value);
+                if (Parse (buf, value) == value)
+                    break;
+            }
+
+            // Replace the Decimal Point of Current Locale
+            auto point = std::localeconv ()->decimal_point[0];
+            auto isInteger = true;
+            for (int i = 0; i < len; i++)
+            {
+                if (buf[i] == point)
+                    buf[i] = '.';
+                if (buf[i] == '.' || buf[i] == 'e')
+                    isInteger = false;
+            }
+            buffer.append (buf, len);
+
+            // Keep Real Affinity
+            if (isInteger)
+                buffer += ".0";
         }
 
-        // #4 Field To SQL
+        static int Format (char *buf, size_t size, int precision,
+            double value)
+        {
+            return std::snprintf (buf, size, "%.*g", precision, value);
+        }
+        static int Format (char *buf, size_t size, int precision,
+            long double value)
+        {
+            return std::snprintf (buf, size, "%.*Lg", precision, value);
+        }
 
-        // Return Field Strings for GroupBy, OrderBy and Select
-        template <typename T>
-        static inline std::string FieldToSql (const Selectable<T> &op)
+        static float Parse (const char *buf, float)
         {
-            if (op.tableName) return (*op.tableName) + "." + op.fieldName;
-            else return op.fieldName;
+            return std::strtof (buf, nullptr);
         }
-        template <typename T, typename... Args>
-        static inline std::string FieldToSql (const Selectable<T> &arg,
-            const Args & ... args)
+        static double Parse (const char *buf, double)
         {
-            return FieldToSql (arg) + "," + FieldToSql (args...);
+            return std::strtod (buf, nullptr);
+        }
+        static long double Parse (const char *buf, long double)
+        {
+            return std::strtold (buf, nullptr);
         }
     };
-}
 
-namespace BOT_ORM
-{
-    // Queryable
+    // Serialization Helper
 
-    template <typename QueryResult>
-    class Queryable
+    struct SerializationHelper
     {
-        template <typename C>
-        using HasInjected =
-            BOT_ORM_Impl::InjectionHelper::HasInjected<C>;
+        template <typename T>
+        static inline
+            std::enable_if_t<TypeString<T>::typeStr == nullptr, bool>
+            Serialize (SQLWriter &, const T &)
+        {}
+        template <typename T>
+        static inline
+            std::enable_if_t<TypeString<T>::typeStr != nullptr, bool>
+            Serialize (SQLWriter &os, const T &value)
+        {
+            os << value;
+            return true;
+        }
 
-    protected:
-        std::shared_ptr<BOT_ORM_Impl::SQLConnector> _connector;
-        QueryResult _queryHelper;
+        static inline bool Serialize (SQLWriter &os,
+            const std::string &value)
+        {
+            os.Quote (value);
+            return true;
+        }
 
-        std::string _sqlFrom;
-        std::string _sqlSelect;
-        std::string _sqlTarget;
+        static inline bool Serialize (SQLWriter &os,
+            const BOT_ORM::Blob &value)
+        {
+            os << "x'";
+            os.Hex (value.data (), value.size ()) << '\'';
+            return true;
+        }
 
-        std::string _sqlWhere;
-        std::string _sqlGroupBy;
-        std::string _sqlHaving;
+        static inline bool Serialize (SQLWriter &os,
+            const BOT_ORM::BlobView &value)
+        {
+            if (value.data == nullptr)
+            {
+                os << "zeroblob(" << value.size << ')';
+                return true;
+            }
+            os << "x'";
+            os.Hex (value.data, value.size) << '\'';
+            return true;
+        }
 
-        std::string _sqlOrderBy;
-        std::string _sqlLimit;
-        std::string _sqlOffset;
+        template <typename T>
+        static inline bool Serialize (
+            SQLWriter &os,
+            const BOT_ORM::Nullable<T> &value)
+        {
+            if (value == nullptr)
+                return false;
+            return Serialize (os, value.Value ());
+        }
+    };
 
-        Queryable (
-            std::shared_ptr<BOT_ORM_Impl::SQLConnector> connector,
-            QueryResult queryHelper,
-            std::string sqlFrom,
-            std::string sqlSelect = "select ",
-            std::string sqlTarget = "*",
-            std::string sqlWhere = std::string {},
-            std::string sqlGroupBy = std::string {},
-            std::string sqlHaving = std::string {},
-            std::string sqlOrderBy = std::string {},
-            std::string sqlLimit = std::string {},
-            std::string sqlOffset = std::string {})
-            :
-            _connector (std::move (connector)),
-            _queryHelper (std::move (queryHelper)),
-            _sqlFrom (std::move (sqlFrom)),
-            _sqlSelect (std::move (sqlSelect)),
-            _sqlTarget (std::move (sqlTarget)),
-            _sqlWhere (std::move (sqlWhere)),
-            _sqlGroupBy (std::move (sqlGroupBy)),
-            _sqlHaving (std::move (sqlHaving)),
-            _sqlOrderBy (std::move (sqlOrderBy)),
-            _sqlLimit (std::move (sqlLimit)),
-            _sqlOffset (std::move (sqlOffset))
-        {}
+    // Binding Helper (for Prepared Statements)
+    // - Parameters are Indexed from 1 and Columns from 0
+    // - Text is Bound without Copying
+    //   (Bindings are Cleared after Stepping)
 
-        template <typename Q> friend class Queryable;
-        friend class ORMapper;
+    struct BindingHelper
+    {
+        template <typename T>
+        static inline std::enable_if_t<std::is_integral<T>::value>
+            Bind (sqlite3_stmt *stmt, int index, const T &value)
+        {
+            Check (stmt, sqlite3_bind_int64 (
+                stmt, index, (sqlite3_int64) value));
+        }
 
-    public:
-        // Distinct
-        inline Queryable Distinct () const &
+        template <typename T>
+        static inline std::enable_if_t<std::is_floating_point<T>::value>
+            Bind (sqlite3_stmt *stmt, int index, const T &value)
         {
-            auto ret = *this;
-            ret._sqlSelect = "select distinct ";
-            return ret;
+            Check (stmt, sqlite3_bind_double (
+                stmt, index, (double) value));
         }
-        inline Queryable Distinct () &&
+
+        static inline void Bind (sqlite3_stmt *stmt, int index,
+            const std::string &value)
         {
-            (*this)._sqlSelect = "select distinct ";
-            return std::move (*this);
+            Check (stmt, sqlite3_bind_text (stmt, index,
+                value.data (), (int) value.size (), SQLITE_STATIC));
         }
 
-        // Where
-        inline Queryable Where (const Expression::Expr &expr) const &
+        // Bind 'bytes' as a Blob Copied by SQLite
+        static inline void BindCopy (sqlite3_stmt *stmt, int index,
+            const std::string &bytes)
         {
-            auto ret = *this;
-            ret._sqlWhere = " where (" + expr.ToString () + ")";
-            return ret;
+            Check (stmt, sqlite3_bind_blob (stmt, index,
+                bytes.data (), (int) bytes.size (), SQLITE_TRANSIENT));
         }
-        inline Queryable Where (const Expression::Expr &expr) &&
+
+        static inline void Bind (sqlite3_stmt *stmt, int index,
+            const BOT_ORM::Blob &value)
         {
-            (*this)._sqlWhere = " where (" + expr.ToString () + ")";
-            return std::move (*this);
+            Bind (stmt, index, BOT_ORM::BlobView { value });
+        }
+
+        static inline void Bind (sqlite3_stmt *stmt, int index,
+            const BOT_ORM::BlobView &value)
+        {
+            // Null 'data' is Bound as NULL by 'sqlite3_bind_blob'
+            if (value.data == nullptr || value.size == 0)
+                Check (stmt, sqlite3_bind_zeroblob (
+                    stmt, index, (int) value.size));
+            else
+                Check (stmt, sqlite3_bind_blob (stmt, index,
+                    value.data, (int) value.size, SQLITE_STATIC));
         }
 
-        // Group By
         template <typename T>
-        inline Queryable GroupBy (const Expression::Field<T> &field) const &
+        static inline void Bind (sqlite3_stmt *stmt, int index,
+            const BOT_ORM::Nullable<T> &value)
         {
-            auto ret = *this;
-            ret._sqlGroupBy = " group by " +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
-            return ret;
+            if (value == nullptr)
+                Check (stmt, sqlite3_bind_null (stmt, index));
+            else
+                Bind (stmt, index, value.Value ());
         }
+
         template <typename T>
-        inline Queryable GroupBy (const Expression::Field<T> &field) &&
+        static inline std::enable_if_t<std::is_integral<T>::value>
+            Column (sqlite3_stmt *stmt, int index, T &property)
         {
-            (*this)._sqlGroupBy = " group by " +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
-            return std::move (*this);
+            if (sqlite3_column_type (stmt, index) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            property = (T) sqlite3_column_int64 (stmt, index);
         }
 
-        // Having
-        inline Queryable Having (const Expression::Expr &expr) const &
+        template <typename T>
+        static inline std::enable_if_t<std::is_floating_point<T>::value>
+            Column (sqlite3_stmt *stmt, int index, T &property)
         {
-            auto ret = *this;
-            ret._sqlHaving = " having " + expr.ToString ();
-            return ret;
+            if (sqlite3_column_type (stmt, index) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            property = (T) sqlite3_column_double (stmt, index);
         }
-        inline Queryable Having (const Expression::Expr &expr) &&
+
+        static inline void Column (sqlite3_stmt *stmt, int index,
+            std::string &property)
         {
-            (*this)._sqlHaving = " having " + expr.ToString ();
-            return std::move (*this);
+            if (sqlite3_column_type (stmt, index) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            if (SQLConnector::IsCompressed (stmt, index))
+            {
+                if (!LZCodec::Decompress (static_cast<const char *> (
+                    sqlite3_column_blob (stmt, index)),
+                    (size_t) sqlite3_column_bytes (stmt, index), property))
+                    throw std::runtime_error (BAD_COMPRESSED);
+                return;
+            }
+            auto text = (const char *) sqlite3_column_text (stmt, index);
+            property.assign (text, sqlite3_column_bytes (stmt, index));
         }
 
-        // Limit
-        inline Queryable Take (size_t count) const &
+        static inline void Column (sqlite3_stmt *stmt, int index,
+            BOT_ORM::Blob &property)
         {
-            auto ret = *this;
-            ret._sqlLimit = " limit " + std::to_string (count);
-            return ret;
+            if (sqlite3_column_type (stmt, index) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            auto data = static_cast<const std::uint8_t *> (
+                sqlite3_column_blob (stmt, index));
+            property.assign (data,
+                data + sqlite3_column_bytes (stmt, index));
         }
-        inline Queryable Take (size_t count) &&
+
+        static inline void Column (sqlite3_stmt *, int,
+            BOT_ORM::BlobView &)
         {
-            (*this)._sqlLimit = " limit " + std::to_string (count);
-            return std::move (*this);
+            throw std::runtime_error (WRITE_ONLY_BLOB);
         }
 
-        // Offset
-        inline Queryable Skip (size_t count) const &
+        template <typename T>
+        static inline void Column (sqlite3_stmt *stmt, int index,
+            BOT_ORM::Nullable<T> &property)
         {
-            auto ret = *this;
-            if (ret._sqlLimit.empty ())
-                ret._sqlLimit = " limit ~0";  // ~0 is a trick :-)
-            ret._sqlOffset = " offset " + std::to_string (count);
-            return ret;
+            if (sqlite3_column_type (stmt, index) != SQLITE_NULL)
+            {
+                T val;
+                Column (stmt, index, val);
+                property = val;
+            }
+            else
+                property = nullptr;
         }
-        inline Queryable Skip (size_t count) &&
+
+    private:
+        static inline void Check (sqlite3_stmt *stmt, int rc)
         {
-            if ((*this)._sqlLimit.empty ())
-                (*this)._sqlLimit = " limit ~0";  // ~0 is a trick :-)
-            (*this)._sqlOffset = " offset " + std::to_string (count);
-            return std::move (*this);
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (std::string ("SQL error: '") +
+                    sqlite3_errstr (rc) + "' at '" +
+                    sqlite3_sql (stmt) + "'");
         }
+    };
 
-        // Order By
+    // Deserialization Helper
+
+    struct DeserializationHelper
+    {
         template <typename T>
-        inline Queryable OrderBy (
-            const Expression::Field<T> &field) const &
+        static inline std::enable_if_t<TypeString<T>::typeStr == nullptr>
+            Deserialize (T &, const char *)
+        {}
+        template <typename T>
+        static inline std::enable_if_t<TypeString<T>::typeStr != nullptr>
+            Deserialize (T &property, const char *value)
         {
-            auto ret = *this;
-            if (ret._sqlOrderBy.empty ())
-                ret._sqlOrderBy = " order by " +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
-            else
-                ret._sqlOrderBy += "," +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
-            return ret;
+            if (value) std::istringstream { value } >> property;
+            else throw std::runtime_error (NULL_DESERIALIZE);
         }
-        template <typename T>
-        inline Queryable OrderBy (
-            const Expression::Field<T> &field) &&
+
+        static inline void Deserialize (std::string &property,
+            const char *value)
         {
-            if ((*this)._sqlOrderBy.empty ())
-                (*this)._sqlOrderBy = " order by " +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
-            else
-                (*this)._sqlOrderBy += "," +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
-            return std::move (*this);
+            if (value) property = value;
+            else throw std::runtime_error (NULL_DESERIALIZE);
+        }
+
+        // Blobs in Text are Hex Digits
+        static inline void Deserialize (BOT_ORM::Blob &property,
+            const char *value)
+        {
+            if (!value)
+                throw std::runtime_error (NULL_DESERIALIZE);
+
+            auto digit = [] (char ch)
+            {
+                if (ch >= '0' && ch <= '9') return ch - '0';
+                if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+                if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+                throw std::runtime_error (BAD_BLOB);
+            };
+            auto length = std::strlen (value);
+            if (length % 2)
+                throw std::runtime_error (BAD_BLOB);
+
+            property.clear ();
+            property.reserve (length / 2);
+            for (; value[0]; value += 2)
+                property.push_back (std::uint8_t (
+                    digit (value[0]) << 4 | digit (value[1])));
+        }
+
+        static inline void Deserialize (BOT_ORM::BlobView &, const char *)
+        {
+            throw std::runtime_error (WRITE_ONLY_BLOB);
         }
 
-        // Order By Desc
         template <typename T>
-        inline Queryable OrderByDescending (
-            const Expression::Field<T> &field) const &
+        static inline void Deserialize (
+            BOT_ORM::Nullable<T> &property, const char *value)
         {
-            auto ret = *this;
-            if (ret._sqlOrderBy.empty ())
-                ret._sqlOrderBy = " order by " +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
+            if (value)
+            {
+                T val;
+                Deserialize (val, value);
+                property = val;
+            }
             else
-                ret._sqlOrderBy += "," +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
-            return ret;
+                property = nullptr;
         }
+
+        // Columns of 'ExecuteQuery' are Read as the Type of 'property'
+        // (the Same as 'Find')
         template <typename T>
-        inline Queryable OrderByDescending (
-            const Expression::Field<T> &field) &&
+        static inline void Deserialize (T &property,
+            const ColumnValue &value)
         {
-            if ((*this)._sqlOrderBy.empty ())
-                (*this)._sqlOrderBy = " order by " +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
+            if (value.text == nullptr)
+                BindingHelper::Column (value.stmt, value.index, property);
             else
-                (*this)._sqlOrderBy += "," +
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
-            return std::move (*this);
+                Deserialize (property, *value.text);
         }
 
-        // Select
-        template <typename... Args>
-        inline auto Select (const Args & ... args) const
+        // Decompressed Text (may Contain '\0')
+        template <typename T>
+        static inline void Deserialize (T &property,
+            const std::string &text)
         {
-            return _NewQuery (
-                BOT_ORM_Impl::QueryableHelper::FieldToSql (args...),
-                _sqlFrom,
-                BOT_ORM_Impl::QueryableHelper::SelectToTuple (args...)
-            );
+            Deserialize (property, text.c_str ());
+        }
+        static inline void Deserialize (std::string &property,
+            const std::string &text)
+        {
+            property = text;
+        }
+        static inline void Deserialize (BOT_ORM::Blob &property,
+            const std::string &text)
+        {
+            property.assign (text.begin (), text.end ());
+        }
+        template <typename T>
+        static inline void Deserialize (
+            BOT_ORM::Nullable<T> &property, const std::string &text)
+        {
+            T val;
+            Deserialize (val, text);
+            property = val;
+        }
+    };
+
+    // Unpacking Tricks :-)
+    // http://stackoverflow.com/questions/26902633/how-to-iterate-over-a-tuple-in-c-11/26902803#26902803
+    // - To avoid the unspecified order,
+    //   brace-enclosed initializer lists can be used,
+    //   which guarantee strict left-to-right order of evaluation.
+    // - To avoid the need for a not void return type,
+    //   the comma operator can be used to
+    //   always yield 1 in each expansion element.
+
+    using Expander = int[];
+
+    // Signature of Functions / Lambdas
+
+    template <typename Fn>
+    struct FunctionTraits : FunctionTraits<decltype (&Fn::operator ())>
+    {};
+
+    template <typename R, typename... Args>
+    struct FunctionTraits<R (*) (Args...)>
+    {
+        using Result = std::decay_t<R>;
+        using Arguments = std::tuple<std::decay_t<Args>...>;
+    };
+
+    template <typename C, typename R, typename... Args>
+    struct FunctionTraits<R (C::*) (Args...)>
+        : FunctionTraits<R (*) (Args...)>
+    {};
+
+    template <typename C, typename R, typename... Args>
+    struct FunctionTraits<R (C::*) (Args...) const>
+        : FunctionTraits<R (*) (Args...)>
+    {};
+
+    // Type of the Field passed to a Parameter
+    // (Nullable<T> for Nullable Fields of T)
+
+    template <typename T>
+    struct FieldType
+    {
+        using type = T;
+    };
+
+    template <typename T>
+    struct FieldType <BOT_ORM::Nullable<T>>
+    {
+        using type = T;
+    };
+
+    // User Function Helper
+    // - Convert Arguments and Results in the Same Way as 'BindingHelper'
+    //   (Types are Checked by 'TypeString')
+    // - Report Exceptions as SQL Errors
+
+    struct FunctionHelper
+    {
+        // Scalar Function 'fn (args...)'
+        template <typename Fn>
+        static void Scalar (sqlite3_context *context,
+            int, sqlite3_value **argv)
+        {
+            using Arguments = typename FunctionTraits<Fn>::Arguments;
+
+            auto &fn = *static_cast<Fn *> (sqlite3_user_data (context));
+            try
+            {
+                Result (context, Call (fn, Arguments {}, argv,
+                    std::make_index_sequence<
+                    std::tuple_size<Arguments>::value> {}));
+            }
+            catch (const std::exception &ex)
+            {
+                sqlite3_result_error (context, ex.what (), -1);
+            }
+        }
+
+        // Aggregate Function
+        // - 'state = step (state, args...)' for each Row,
+        //   starting from 'state = init'
+        // - 'final (state)' at the End
+        template <typename StateT, typename StepFn, typename FinalFn>
+        struct Aggregate
+        {
+            StateT init;
+            StepFn step;
+            FinalFn final;
+        };
+
+        template <typename Agg>
+        static void Step (sqlite3_context *context,
+            int, sqlite3_value **argv)
+        {
+            using Arguments = typename FunctionTraits<
+                decltype (Agg::step)>::Arguments;
+
+            auto &agg = *static_cast<Agg *> (sqlite3_user_data (context));
+            try
+            {
+                auto &state = GroupState (context, agg);
+                state = CallStep (agg.step, std::move (state),
+                    Arguments {}, argv, std::make_index_sequence<
+                    std::tuple_size<Arguments>::value - 1> {});
+            }
+            catch (const std::exception &ex)
+            {
+                sqlite3_result_error (context, ex.what (), -1);
+            }
+        }
+
+        template <typename Agg>
+        static void Final (sqlite3_context *context)
+        {
+            auto &agg = *static_cast<Agg *> (sqlite3_user_data (context));
+            using StatePtr = decltype (&agg.init);
+
+            // Null if NO Row was Stepped
+            auto pState = static_cast<StatePtr *> (
+                sqlite3_aggregate_context (context, 0));
+            std::unique_ptr<std::remove_pointer_t<StatePtr>> state (
+                pState ? *pState : nullptr);
+            try
+            {
+                Result (context, agg.final (state ? *state : agg.init));
+            }
+            catch (const std::exception &ex)
+            {
+                sqlite3_result_error (context, ex.what (), -1);
+            }
+        }
+
+        template <typename T>
+        static void Destroy (void *app)
+        {
+            delete static_cast<T *> (app);
+        }
+
+        template <typename T>
+        static inline std::enable_if_t<std::is_integral<T>::value>
+            Argument (sqlite3_value *value, T &arg)
+        {
+            (void) TypeString<T>::typeStr;
+            if (sqlite3_value_type (value) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            arg = (T) sqlite3_value_int64 (value);
+        }
+
+        template <typename T>
+        static inline std::enable_if_t<std::is_floating_point<T>::value>
+            Argument (sqlite3_value *value, T &arg)
+        {
+            if (sqlite3_value_type (value) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            arg = (T) sqlite3_value_double (value);
+        }
+
+        static inline void Argument (sqlite3_value *value,
+            std::string &arg)
+        {
+            if (sqlite3_value_type (value) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            auto text = (const char *) sqlite3_value_text (value);
+            arg.assign (text, sqlite3_value_bytes (value));
+        }
+
+        static inline void Argument (sqlite3_value *value,
+            BOT_ORM::Blob &arg)
+        {
+            if (sqlite3_value_type (value) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            auto data = static_cast<const std::uint8_t *> (
+                sqlite3_value_blob (value));
+            arg.assign (data, data + sqlite3_value_bytes (value));
+        }
+
+        // Valid during the Call
+        static inline void Argument (sqlite3_value *value,
+            BOT_ORM::BlobView &arg)
+        {
+            if (sqlite3_value_type (value) == SQLITE_NULL)
+                throw std::runtime_error (NULL_DESERIALIZE);
+            arg.data = sqlite3_value_blob (value);
+            arg.size = (size_t) sqlite3_value_bytes (value);
+        }
+
+        template <typename T>
+        static inline void Argument (sqlite3_value *value,
+            BOT_ORM::Nullable<T> &arg)
+        {
+            if (sqlite3_value_type (value) != SQLITE_NULL)
+            {
+                T val;
+                Argument (value, val);
+                arg = val;
+            }
+            else
+                arg = nullptr;
+        }
+
+        template <typename T>
+        static inline std::enable_if_t<std::is_integral<T>::value>
+            Result (sqlite3_context *context, const T &value)
+        {
+            (void) TypeString<T>::typeStr;
+            sqlite3_result_int64 (context, (sqlite3_int64) value);
+        }
+
+        template <typename T>
+        static inline std::enable_if_t<std::is_floating_point<T>::value>
+            Result (sqlite3_context *context, const T &value)
+        {
+            sqlite3_result_double (context, (double) value);
+        }
+
+        static inline void Result (sqlite3_context *context,
+            const std::string &value)
+        {
+            sqlite3_result_text (context, value.data (),
+                (int) value.size (), SQLITE_TRANSIENT);
+        }
+
+        static inline void Result (sqlite3_context *context,
+            const BOT_ORM::Blob &value)
+        {
+            Result (context, BOT_ORM::BlobView { value });
+        }
+
+        static inline void Result (sqlite3_context *context,
+            const BOT_ORM::BlobView &value)
+        {
+            if (value.data == nullptr)
+                sqlite3_result_zeroblob (context, (int) value.size);
+            else
+                sqlite3_result_blob (context, value.data,
+                    (int) value.size, SQLITE_TRANSIENT);
+        }
+
+        template <typename T>
+        static inline void Result (sqlite3_context *context,
+            const BOT_ORM::Nullable<T> &value)
+        {
+            if (value == nullptr)
+                sqlite3_result_null (context);
+            else
+                Result (context, value.Value ());
+        }
+
+    private:
+        template <typename Fn, typename... Args, size_t... Index>
+        static inline auto Call (Fn &fn, std::tuple<Args...> &&args,
+            sqlite3_value **argv, std::index_sequence<Index...>)
+        {
+            (void) Expander {
+                0, (Argument (argv[Index], std::get<Index> (args)), 0)...
+            };
+            return fn (std::get<Index> (args)...);
+        }
+
+        template <typename Fn, typename StateT, typename... Args,
+            size_t... Index>
+        static inline auto CallStep (Fn &fn, StateT &&state,
+            std::tuple<Args...> &&args,
+            sqlite3_value **argv, std::index_sequence<Index...>)
+        {
+            (void) Expander {
+                0, (Argument (argv[Index],
+                    std::get<Index + 1> (args)), 0)...
+            };
+            return fn (std::move (state), std::get<Index + 1> (args)...);
+        }
+
+        // State of the Current Group
+        // (Kept by Pointer, since it may NOT be Trivial)
+        template <typename Agg>
+        static inline auto &GroupState (sqlite3_context *context,
+            Agg &agg)
+        {
+            using StatePtr = decltype (&agg.init);
+
+            auto pState = static_cast<StatePtr *> (
+                sqlite3_aggregate_context (context, sizeof (StatePtr)));
+            if (pState == nullptr)
+                throw std::bad_alloc ();
+            if (*pState == nullptr)
+                *pState = new std::remove_pointer_t<StatePtr> (agg.init);
+            return **pState;
+        }
+    };
+
+    // Compile-time Field Names
+    // - 'StringView' is a minimal 'std::string_view' for C++ 14
+    // - '__FieldNames' is Split at Compile-time by 'SplitFieldNames'
+
+    struct StringView
+    {
+        const char *data;
+        size_t size;
+
+        std::string ToString () const
+        {
+            return std::string (data, size);
+        }
+
+        bool operator == (const char *str) const
+        {
+            return std::char_traits<char>::length (str) == size &&
+                std::char_traits<char>::compare (data, str, size) == 0;
+        }
+    };
+
+    inline SQLWriter &operator << (SQLWriter &os, const StringView &str)
+    {
+        return os.Write (str.data, str.size);
+    }
+
+    template <size_t N>
+    struct FieldNameList
+    {
+        StringView names[N];
+
+        constexpr const StringView &operator [] (size_t index) const
+        {
+            return names[index];
+        }
+        constexpr size_t size () const { return N; }
+        constexpr const StringView *begin () const { return names; }
+        constexpr const StringView *end () const { return names + N; }
+    };
+
+    constexpr bool IsFieldNameChar (char ch)
+    {
+        return (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') ||
+            (ch >= 'A' && ch <= 'Z') || ch == '_';
+    }
+
+    constexpr size_t CountFieldNames (const char *input)
+    {
+        size_t count = 0;
+        bool inName = false;
+        for (; *input; input++)
+        {
+            if (IsFieldNameChar (*input))
+            {
+                if (!inName)
+                    count++;
+                inName = true;
+            }
+            else if (*input == ',')
+                inName = false;
+        }
+        return count;
+    }
+
+    template <size_t N>
+    constexpr FieldNameList<N> SplitFieldNames (const char *input)
+    {
+        FieldNameList<N> ret {};
+        size_t count = 0;
+        const char *begin = nullptr, *end = nullptr;
+        for (; ; input++)
+        {
+            if (*input == ',' || *input == '\0')
+            {
+                if (begin != nullptr)
+                    ret.names[count++] = StringView {
+                    begin, size_t (end - begin) };
+                begin = nullptr;
+
+                if (*input == '\0')
+                    break;
+            }
+            else if (IsFieldNameChar (*input))
+            {
+                if (begin == nullptr)
+                    begin = input;
+                end = input + 1;
+            }
+        }
+        return ret;
+    }
+
+    // Injection Helper
+
+    class InjectionHelper
+    {
+        // Metadata of Injected Classes (Constant Initialized)
+        template <typename C>
+        struct Metadata
+        {
+            static constexpr size_t fieldCount =
+                CountFieldNames (C::__FieldNames);
+            static constexpr FieldNameList<fieldCount> fieldNames =
+                SplitFieldNames<fieldCount> (C::__FieldNames);
+        };
+
+    public:
+        // Checking Injection
+        template <typename T> class HasInjected
+        {
+            template <typename...> struct make_void { using type = void; };
+            template <typename... _Types>
+            using void_t = typename make_void<_Types...>::type;
+
+            template <typename, typename = void_t<>>
+            struct Test : std::false_type {};
+            template <typename U>
+            struct Test <U, void_t<decltype (U::__TableName)>>
+                : std::true_type
+            {};
+
+        public:
+            static constexpr bool value = Test<T>::value;
+
+            static_assert (value, NO_ORMAP);
+        };
+
+        // Named Tables are NOT Injected (but Take their Place)
+        template <typename C>
+        class HasInjected<BOT_ORM::NamedTable<C>> : public std::false_type
+        {};
+
+        // Proxy Function
+        template <typename C, typename Fn>
+        static inline decltype (auto) Visit (C &obj, Fn fn)
+        {
+            return obj.__Accept (fn);
+        }
+
+        // Field Name Proxy
+        template <typename C>
+        static inline const auto &FieldNames (const C &)
+        {
+            return Metadata<C>::fieldNames;
+        }
+
+        // Table Name Proxy
+        template <typename C>
+        static inline const std::string &TableName (const C &)
+        {
+            static const std::string tableName { C::__TableName };
+            return tableName;
+        }
+
+        // Field Layout Proxy
+        // - Offsets of Fields in a Default Constructed Instance
+        // - Computed Once for each Class
+        template <typename C>
+        struct FieldLayout
+        {
+            C instance;
+            size_t offsets[Metadata<C>::fieldCount];
+
+            FieldLayout () : instance {}
+            {
+                Visit (instance, [this] (const auto & ... args)
+                {
+                    size_t index = 0;
+                    (void) Expander
+                    {
+                        0, (offsets[index++] = size_t (
+                            (const char *) &args -
+                            (const char *) &instance), 0)...
+                    };
+                });
+            }
+        };
+
+        template <typename C>
+        static inline const FieldLayout<C> &Layout ()
+        {
+            static const FieldLayout<C> layout;
+            return layout;
+        }
+
+        // Index of Field for Member Pointer
+        template <typename C, typename T>
+        static inline size_t FieldIndex (T C::*member)
+        {
+            const auto &layout = Layout<C> ();
+            auto offset = size_t (
+                (const char *) &(layout.instance.*member) -
+                (const char *) &layout.instance);
+
+            for (size_t index = 0; index < Metadata<C>::fieldCount; index++)
+                if (layout.offsets[index] == offset)
+                    return index;
+            throw std::runtime_error (NO_FIELD);
+        }
+    };
+
+    // Definitions of Metadata (Required by ODR-use in C++ 14)
+
+    template <typename C>
+    constexpr size_t InjectionHelper::Metadata<C>::fieldCount;
+
+    template <typename C>
+    constexpr FieldNameList<InjectionHelper::Metadata<C>::fieldCount>
+        InjectionHelper::Metadata<C>::fieldNames;
+
+    // Read-only Eponymous Virtual Table over 'std::vector<C>'
+    // - Columns are the Fields of C, and Rowid is the Index + 1
+    // - Rows are Read from the Vector in place (NOT Copied)
+    // - 'rowid = ?' and 'key = ?' (the First Field) are Pushed Down,
+    //   and Keys are Indexed by their SQL Literals
+
+    template <typename C>
+    class ExposedTable
+    {
+    public:
+        ExposedTable (const std::vector<C> &entities)
+        {
+            Reset (entities);
+        }
+
+        void Reset (const std::vector<C> &entities)
+        {
+            this->entities = &entities;
+            keys.clear ();
+            keys.reserve (entities.size ());
+            for (size_t index = 0; index < entities.size (); index++)
+            {
+                SQLWriter os;
+                if (SerializeKey (os, entities[index]))
+                    keys.emplace (os.Release (), index);
+            }
+        }
+
+        static const sqlite3_module *Module ()
+        {
+            static const sqlite3_module module = [] ()
+            {
+                sqlite3_module ret {};
+                ret.iVersion = 1;
+                ret.xCreate = nullptr;  // Eponymous Only
+                ret.xConnect = Connect;
+                ret.xBestIndex = BestIndex;
+                ret.xDisconnect = Disconnect;
+                ret.xDestroy = Disconnect;
+                ret.xOpen = Open;
+                ret.xClose = Close;
+                ret.xFilter = Filter;
+                ret.xNext = Next;
+                ret.xEof = Eof;
+                ret.xColumn = Column;
+                ret.xRowid = Rowid;
+                return ret;
+            } ();
+            return &module;
+        }
+
+    private:
+        const std::vector<C> *entities;
+        std::unordered_multimap<std::string, size_t> keys;
+
+        enum Plan { FullScan, ByRowid, ByKey };
+
+        struct VTab
+        {
+            sqlite3_vtab base;
+            ExposedTable *table;
+        };
+
+        struct Cursor
+        {
+            sqlite3_vtab_cursor base;
+            ExposedTable *table;
+            std::vector<size_t> rows;  // Matched Rows if NOT Full Scan
+            bool fullScan;
+            size_t pos;
+        };
+
+        static bool SerializeKey (SQLWriter &os, const C &entity)
+        {
+            return InjectionHelper::Visit (entity,
+                [&os] (const auto &key, const auto & ...)
+            {
+                return SerializationHelper::Serialize (os, key);
+            });
+        }
+
+        static int Connect (sqlite3 *db, void *aux, int, const char *const *,
+            sqlite3_vtab **ppVTab, char **)
+        {
+            const C entity {};
+            const auto &fieldNames = InjectionHelper::FieldNames (entity);
+
+            SQLWriter os;
+            os << "create table x(";
+            InjectionHelper::Visit (entity,
+                [&os, &fieldNames] (const auto & ... args)
+            {
+                size_t index = 0;
+                (void) Expander
+                {
+                    0, (os << (index ? "," : "") << fieldNames[index] <<
+                        TypeString<std::decay_t<decltype (args)>>::typeStr,
+                        index++, 0)...
+                };
+            });
+            os << ");";
+
+            auto rc = sqlite3_declare_vtab (db, os.Str ().c_str ());
+            if (rc != SQLITE_OK)
+                return rc;
+
+            auto vtab = new (std::nothrow) VTab {};
+            if (vtab == nullptr)
+                return SQLITE_NOMEM;
+            vtab->table = static_cast<ExposedTable *> (aux);
+            *ppVTab = &vtab->base;
+            return SQLITE_OK;
+        }
+
+        static int Disconnect (sqlite3_vtab *pVTab)
+        {
+            delete reinterpret_cast<VTab *> (pVTab);
+            return SQLITE_OK;
+        }
+
+        static int BestIndex (sqlite3_vtab *pVTab, sqlite3_index_info *info)
+        {
+            auto table = reinterpret_cast<VTab *> (pVTab)->table;
+            int plan = FullScan, argument = -1;
+            for (int i = 0; i < info->nConstraint; i++)
+            {
+                const auto &constraint = info->aConstraint[i];
+                if (!constraint.usable ||
+                    constraint.op != SQLITE_INDEX_CONSTRAINT_EQ)
+                    continue;
+
+                if (constraint.iColumn == -1)
+                {
+                    plan = ByRowid;
+                    argument = i;
+                    break;
+                }
+                if (constraint.iColumn == 0 && plan == FullScan)
+                {
+                    plan = ByKey;
+                    argument = i;
+                }
+            }
+
+            info->idxNum = plan;
+            if (plan == FullScan)
+            {
+                info->estimatedCost = 1.0 + table->entities->size ();
+                info->estimatedRows = table->entities->size ();
+                return SQLITE_OK;
+            }
+
+            // Keys are Double-checked by SQLite (for Type Affinity)
+            info->aConstraintUsage[argument].argvIndex = 1;
+            info->aConstraintUsage[argument].omit = plan == ByRowid;
+            info->estimatedCost = 1.0;
+            info->estimatedRows = 1;
+            if (plan == ByRowid)
+                info->idxFlags = SQLITE_INDEX_SCAN_UNIQUE;
+            return SQLITE_OK;
+        }
+
+        static int Open (sqlite3_vtab *pVTab,
+            sqlite3_vtab_cursor **ppCursor)
+        {
+            auto cursor = new (std::nothrow) Cursor {};
+            if (cursor == nullptr)
+                return SQLITE_NOMEM;
+            cursor->table = reinterpret_cast<VTab *> (pVTab)->table;
+            *ppCursor = &cursor->base;
+            return SQLITE_OK;
+        }
+
+        static int Close (sqlite3_vtab_cursor *pCursor)
+        {
+            delete reinterpret_cast<Cursor *> (pCursor);
+            return SQLITE_OK;
+        }
+
+        static int Filter (sqlite3_vtab_cursor *pCursor, int idxNum,
+            const char *, int, sqlite3_value **argv)
+        {
+            auto cursor = reinterpret_cast<Cursor *> (pCursor);
+            const auto &entities = *cursor->table->entities;
+            cursor->fullScan = idxNum == FullScan;
+            cursor->rows.clear ();
+            cursor->pos = 0;
+
+            try
+            {
+                if (idxNum == ByRowid)
+                {
+                    auto rowid = sqlite3_value_int64 (argv[0]);
+                    if (sqlite3_value_type (argv[0]) != SQLITE_NULL &&
+                        rowid >= 1 &&
+                        (std::uint64_t) rowid <= entities.size ())
+                        cursor->rows.push_back (size_t (rowid - 1));
+                }
+                else if (idxNum == ByKey &&
+                    sqlite3_value_type (argv[0]) != SQLITE_NULL)
+                {
+                    SQLWriter os;
+                    const C entity {};
+                    auto isKey = InjectionHelper::Visit (entity,
+                        [&os, &argv] (const auto &key, const auto & ...)
+                    {
+                        std::decay_t<decltype (key)> value;
+                        FunctionHelper::Argument (argv[0], value);
+                        return SerializationHelper::Serialize (os, value);
+                    });
+
+                    auto range = cursor->table->keys.equal_range (
+                        isKey ? os.Release () : std::string {});
+                    for (auto it = range.first; it != range.second; ++it)
+                        cursor->rows.push_back (it->second);
+                    std::sort (cursor->rows.begin (), cursor->rows.end ());
+                }
+            }
+            catch (const std::bad_alloc &)
+            {
+                return SQLITE_NOMEM;
+            }
+            catch (...)
+            {
+                return SQLITE_ERROR;
+            }
+            return SQLITE_OK;
+        }
+
+        static int Next (sqlite3_vtab_cursor *pCursor)
+        {
+            reinterpret_cast<Cursor *> (pCursor)->pos++;
+            return SQLITE_OK;
+        }
+
+        static int Eof (sqlite3_vtab_cursor *pCursor)
+        {
+            auto cursor = reinterpret_cast<Cursor *> (pCursor);
+            return cursor->pos >= (cursor->fullScan
+                ? cursor->table->entities->size ()
+                : cursor->rows.size ());
+        }
+
+        static size_t Row (const Cursor *cursor)
+        {
+            return cursor->fullScan ? cursor->pos : cursor->rows[cursor->pos];
+        }
+
+        static int Column (sqlite3_vtab_cursor *pCursor,
+            sqlite3_context *context, int column)
+        {
+            auto cursor = reinterpret_cast<Cursor *> (pCursor);
+            const auto &entity = (*cursor->table->entities)[Row (cursor)];
+            InjectionHelper::Visit (entity,
+                [context, column] (const auto & ... args)
+            {
+                int index = 0;
+                (void) Expander
+                {
+                    0, (index++ == column
+                        ? FunctionHelper::Result (context, args)
+                        : (void) 0, 0)...
+                };
+            });
+            return SQLITE_OK;
+        }
+
+        static int Rowid (sqlite3_vtab_cursor *pCursor,
+            sqlite_int64 *pRowid)
+        {
+            *pRowid = (sqlite_int64) Row (
+                reinterpret_cast<Cursor *> (pCursor)) + 1;
+            return SQLITE_OK;
+        }
+    };
+
+    // Name of the Full-text Index of 'field' in 'tableName'
+    inline std::string FullTextName (const std::string &tableName,
+                                     const std::string &field)
+    {
+        return tableName + "_fts_" + field;
+    }
+
+    // Name of the Spatial Index of 'fields' ("min1,max1,...")
+    inline std::string SpatialName (const std::string &tableName,
+                                    std::string fields)
+    {
+        std::replace (fields.begin (), fields.end (), ',', '_');
+        return tableName + "_rtree_" + fields;
+    }
+
+    // Split "min1,max1,..." into Field Names
+    inline std::vector<std::string> SplitFields (const std::string &fields)
+    {
+        std::vector<std::string> ret (1);
+        for (auto ch : fields)
+        {
+            if (ch == ',')
+                ret.emplace_back ();
+            else
+                ret.back () += ch;
+        }
+        return ret;
+    }
+}
+
+namespace BOT_ORM
+{
+    namespace Expression
+    {
+        // SetExpr
+
+        struct SetExpr
+        {
+            SetExpr (std::string field_op_val)
+                : _expr { std::move (field_op_val) }
+            {}
+
+            const std::string &ToString () const
+            {
+                return _expr;
+            }
+
+            inline SetExpr operator && (const SetExpr &rhs) const
+            {
+                return SetExpr { _expr + "," + rhs._expr };
+            }
+
+        private:
+            std::string _expr;
+        };
+
+        // Selectable
+
+        template <typename T>
+        struct Selectable
+        {
+            std::string fieldName;
+            const std::string *tableName;
+
+            Selectable (std::string _fieldName,
+                const std::string *_tableName)
+                : fieldName (std::move (_fieldName)), tableName (_tableName)
+            {}
+        };
+
+        // Field : Selectable
+
+        template <typename T>
+        struct Field : public Selectable<T>
+        {
+            Field (std::string _fieldName,
+                const std::string *_tableName)
+                : Selectable<T> (std::move (_fieldName), _tableName) {}
+
+            inline SetExpr operator = (T value)
+            {
+                BOT_ORM_Impl::SQLWriter os;
+                BOT_ORM_Impl::SerializationHelper::
+                    Serialize (os << this->fieldName << '=', value);
+                return SetExpr { os.Release () };
+            }
+        };
+
+        // Nullable Field : Field : Selectable
+
+        template <typename T>
+        struct NullableField : public Field<T>
+        {
+            NullableField (std::string _fieldName,
+                const std::string *_tableName)
+                : Field<T> (std::move (_fieldName), _tableName) {}
+
+            inline SetExpr operator = (T value)
+            {
+                BOT_ORM_Impl::SQLWriter os;
+                BOT_ORM_Impl::SerializationHelper::
+                    Serialize (os << this->fieldName << '=', value);
+                return SetExpr { os.Release () };
+            }
+
+            inline SetExpr operator = (std::nullptr_t)
+            {
+                return SetExpr { this->fieldName + "=null" };
+            }
+        };
+
+        // Aggregate Function : Selectable
+
+        template <typename T>
+        struct Aggregate : public Selectable<T>
+        {
+            Aggregate (std::string function)
+                : Selectable<T> (std::move (function), nullptr) {}
+
+            Aggregate (std::string function, const Field<T> &field)
+                : Selectable<T> (std::move (function) + "(" +
+                    *(field.tableName) + "." +
+                    field.fieldName + ")", nullptr)
+            {}
+        };
+
+        // Scalar Function : Selectable
+
+        template <typename T>
+        struct Function : public Selectable<T>
+        {
+            // Unqualified Form (Required by Index Expressions)
+            std::string columnExpr;
+
+            template <typename... U>
+            Function (std::string function, const Field<U> & ... fields)
+                : Selectable<T> (function + "(" +
+                    _JoinFields ({ *(fields.tableName) + "." +
+                        fields.fieldName ... }) + ")", nullptr),
+                columnExpr (std::move (function) + "(" +
+                    _JoinFields ({ fields.fieldName ... }) + ")")
+            {}
+
+        private:
+            static std::string _JoinFields (
+                const std::vector<std::string> &fields)
+            {
+                std::string ret;
+                for (const auto &field : fields)
+                    ret += (ret.empty () ? "" : ",") + field;
+                return ret;
+            }
+        };
+
+        // User Function : Call with Fields of 'Args'
+
+        template <typename T, typename... Args>
+        struct UserFunction
+        {
+            std::string name;
+
+            inline Function<T> operator () (
+                const Field<Args> & ... fields) const
+            {
+                return Function<T> { name, fields... };
+            }
+        };
+
+        // User Aggregate Function : Call with Fields of 'Args'
+
+        template <typename T, typename... Args>
+        struct UserAggregate
+        {
+            std::string name;
+
+            inline Aggregate<T> operator () (
+                const Field<Args> & ... fields) const
+            {
+                return Aggregate<T> {
+                    Function<T> { name, fields... }.fieldName };
+            }
+        };
+
+        // Expr
+
+        struct Expr
+        {
+            template <typename T>
+            Expr (const Selectable<T> &field, std::string op_val)
+                : _exprs { { field.fieldName + op_val, field.tableName } }
+            {}
+
+            template <typename T>
+            Expr (const Selectable<T> &field, std::string op, T value)
+            {
+                BOT_ORM_Impl::SQLWriter os;
+                BOT_ORM_Impl::SerializationHelper::
+                    Serialize (os << field.fieldName << op, value);
+                _exprs.emplace_back (os.Release (), field.tableName);
+            }
+
+            template <typename T>
+            Expr (const Field<T> &field1,
+                std::string op,
+                const Field<T> &field2)
+                : _exprs
+            {
+                { field1.fieldName, field1.tableName },
+                { std::move (op), nullptr },
+                { field2.fieldName, field2.tableName }
+            }
+            {}
+
+            std::string ToString () const
+            {
+                BOT_ORM_Impl::SQLWriter out;
+                for (const auto &expr : _exprs)
+                {
+                    if (expr.second != nullptr)
+                        out << *(expr.second) << '.';
+                    out << expr.first;
+                }
+                return out.Release ();
+            }
+
+            inline Expr operator && (const Expr &rhs) const
+            {
+                return And_Or (rhs, " and ");
+            }
+            inline Expr operator || (const Expr &rhs) const
+            {
+                return And_Or (rhs, " or ");
+            }
+
+        private:
+            std::list<std::pair<std::string, const std::string *>> _exprs;
+
+            Expr And_Or (const Expr &rhs, std::string logOp) const
+            {
+                auto ret = *this;
+                auto rigthExprs = rhs._exprs;
+                ret._exprs.emplace_front ("(", nullptr);
+                ret._exprs.emplace_back (std::move (logOp), nullptr);
+                ret._exprs.splice (ret._exprs.cend (),
+                    std::move (rigthExprs));
+                ret._exprs.emplace_back (")", nullptr);
+                return ret;
+            }
+        };
+
+        // Field / Aggregate ? Value
+
+        template <typename T>
+        inline Expr operator == (const Selectable<T> &op, T value)
+        {
+            return Expr (op, "=", std::move (value));
+        }
+
+        template <typename T>
+        inline Expr operator != (const Selectable<T> &op, T value)
+        {
+            return Expr (op, "!=", std::move (value));
+        }
+
+        template <typename T>
+        inline Expr operator > (const Selectable<T> &op, T value)
+        {
+            return Expr (op, ">", std::move (value));
+        }
+
+        template <typename T>
+        inline Expr operator >= (const Selectable<T> &op, T value)
+        {
+            return Expr (op, ">=", std::move (value));
+        }
+
+        template <typename T>
+        inline Expr operator < (const Selectable<T> &op, T value)
+        {
+            return Expr (op, "<", std::move (value));
+        }
+
+        template <typename T>
+        inline Expr operator <= (const Selectable<T> &op, T value)
+        {
+            return Expr (op, "<=", std::move (value));
+        }
+
+        // Field ? Field
+
+        template <typename T>
+        inline Expr operator == (const Field<T> &op1, const Field<T> &op2)
+        {
+            return Expr { op1 , "=", op2 };
+        }
+
+        template <typename T>
+        inline Expr operator != (const Field<T> &op1, const Field<T> &op2)
+        {
+            return Expr { op1, "!=", op2 };
+        }
+
+        template <typename T>
+        inline Expr operator > (const Field<T> &op1, const Field<T> &op2)
+        {
+            return Expr { op1 , ">", op2 };
+        }
+
+        template <typename T>
+        inline Expr operator >= (const Field<T> &op1, const Field<T> &op2)
+        {
+            return Expr { op1, ">=", op2 };
+        }
+
+        template <typename T>
+        inline Expr operator < (const Field<T> &op1, const Field<T> &op2)
+        {
+            return Expr { op1 , "<", op2 };
+        }
+
+        template <typename T>
+        inline Expr operator <= (const Field<T> &op1, const Field<T> &op2)
+        {
+            return Expr { op1, "<=", op2 };
+        }
+
+        // Nullable Field == / != nullptr
+
+        template <typename T>
+        inline Expr operator == (const NullableField<T> &op, std::nullptr_t)
+        {
+            return Expr { op, " is null" };
+        }
+
+        template <typename T>
+        inline Expr operator != (const NullableField<T> &op, std::nullptr_t)
+        {
+            return Expr { op, " is not null" };
+        }
+
+        // String Field & / | std::string
+
+        inline Expr operator & (const Field<std::string> &field,
+            std::string val)
+        {
+            return Expr (field, " like ", std::move (val));
+        }
+
+        inline Expr operator | (const Field<std::string> &field,
+            std::string val)
+        {
+            return Expr (field, " not like ", std::move (val));
+        }
+
+        // Full-text Search (by the Index of 'Constraint::FullText')
+
+        inline Expr Match (const Field<std::string> &field,
+            const std::string &query)
+        {
+            auto index = BOT_ORM_Impl::FullTextName (
+                *(field.tableName), field.fieldName);
+
+            BOT_ORM_Impl::SQLWriter os;
+            os << " in (select rowid from " << index
+                << " where " << index << " match ";
+            os.Quote (query) << ')';
+            return Expr { Selectable<std::string> {
+                "rowid", field.tableName }, os.Release () };
+        }
+
+        // BM25 Score of 'Search (field, query)' (Lower is Better)
+        inline auto Rank (const Field<std::string> &field)
+        {
+            return Selectable<double> { BOT_ORM_Impl::FullTextName (
+                *(field.tableName), field.fieldName) + ".rank", nullptr };
+        }
+
+        // Scalar Function Helpers
+
+        inline auto Lower (const Field<std::string> &field)
+        {
+            return Function<std::string> { "lower", field };
+        }
+
+        inline auto Upper (const Field<std::string> &field)
+        {
+            return Function<std::string> { "upper", field };
+        }
+
+        template <typename T>
+        inline auto Abs (const Field<T> &field)
+        {
+            return Function<T> { "abs", field };
+        }
+
+        // Aggregate Function Helpers
+
+        inline auto Count ()
+        {
+            return Aggregate<size_t> { "count (*)" };
+        }
+
+        template <typename T>
+        inline auto Count (const Field<T> &field)
+        {
+            return Aggregate<T> { "count", field };
+        }
+
+        template <typename T>
+        inline auto Sum (const Field<T> &field)
+        {
+            return Aggregate<T> { "sum", field };
+        }
+
+        template <typename T>
+        inline auto Avg (const Field<T> &field)
+        {
+            return Aggregate<T> { "avg", field };
+        }
+
+        template <typename T>
+        inline auto Max (const Field<T> &field)
+        {
+            return Aggregate<T> { "max", field };
+        }
+
+        template <typename T>
+        inline auto Min (const Field<T> &field)
+        {
+            return Aggregate<T> { "min", field };
+        }
+    }
+
+    class ORMapper;
+    class Snapshot;
+
+    class Constraint
+    {
+    protected:
+        std::string constraint;
+        std::string field;
+        std::string index;
+        std::string option;
+        std::string unique;
+        std::string fullText;
+        std::string spatial;
+        bool primaryKey;
+        bool compressed;
+
+        Constraint (std::string &&_constraint,
+            std::string _field = std::string {},
+            std::string _index = std::string {})
+            : constraint (_constraint), field (std::move (_field)),
+            index (std::move (_index)), primaryKey (false),
+            compressed (false)
+        {}
+
+        static inline Constraint MakeOption (std::string option)
+        {
+            auto ret = Constraint { std::string {} };
+            ret.option = std::move (option);
+            return ret;
+        }
+
+        // Turn Column List / Predicate into a part of Index Name
+        static std::string IndexName (const std::string &columns)
+        {
+            std::string ret;
+            for (char ch : columns)
+            {
+                if (isalnum ((unsigned char) ch) || ch == '_')
+                    ret += ch;
+                else if (!ret.empty () && ret.back () != '_')
+                    ret += '_';
+            }
+            if (!ret.empty () && ret.back () == '_')
+                ret.pop_back ();
+            return ret;
+        }
+
+        // Stable Hash (FNV-1a) of an Index Definition in 8 Hex Digits
+        // - Tells apart Expressions / Predicates that 'IndexName'
+        //   Turns into the Same Name (e.g. 'id>1' and 'id<1')
+        static std::string IndexHash (const std::string &definition)
+        {
+            std::uint32_t hash = 2166136261u;
+            for (char ch : definition)
+            {
+                hash ^= (unsigned char) ch;
+                hash *= 16777619u;
+            }
+
+            std::string ret;
+            for (int shift = 28; shift >= 0; shift -= 4)
+                ret += "0123456789abcdef"[(hash >> shift) & 0xF];
+            return ret;
+        }
+
+        static inline Constraint MakeIndex (
+            const std::string &columns)
+        {
+            auto name = IndexName (columns);
+
+            // NOT a Plain Column List (e.g. 'lower(x)')
+            if (std::any_of (columns.begin (), columns.end (), [] (char ch)
+            {
+                return !isalnum ((unsigned char) ch) && ch != '_' &&
+                    ch != ',';
+            }))
+                name += "_" + IndexHash (columns);
+
+            return Constraint { "(" + columns + ")",
+                std::string {}, std::move (name) };
+        }
+
+        static inline Constraint MakeIndex (
+            const std::string &columns,
+            const Expression::Expr &where)
+        {
+            auto whereStr = where.ToString ();
+            auto definition = "(" + columns + ") where (" + whereStr + ")";
+            auto name = IndexName (columns) + "_where_" +
+                IndexName (whereStr) + "_" + IndexHash (definition);
+            return Constraint { std::move (definition),
+                std::string {}, std::move (name) };
+        }
+
+        friend class ORMapper;
+
+    public:
+        struct CompositeField
+        {
+            std::string fieldName;
+            const std::string *tableName;
+
+            template <typename... Fields>
+            CompositeField (const Fields & ... args)
+                : tableName (nullptr)
+            {
+                (void) BOT_ORM_Impl::Expander
+                {
+                    0, (Extract (args), 0)...
+                };
+            }
+
+        private:
+            template <typename T>
+            void Extract (const Expression::Field<T> &field)
+            {
+                if (tableName != nullptr && tableName != field.tableName)
+                    throw std::runtime_error (NOT_SAME_TABLE);
+                tableName = field.tableName;
+                if (fieldName.empty ())
+                    fieldName = field.fieldName;
+                else
+                    fieldName += "," + field.fieldName;
+            }
+        };
+
+        template <typename T>
+        static inline Constraint Default (
+            const Expression::Field<T> &field,
+            const T &value)
+        {
+            BOT_ORM_Impl::SQLWriter os;
+            BOT_ORM_Impl::SerializationHelper::
+                Serialize (os << " default ", value);
+            return Constraint { os.Release (), field.fieldName };
+        }
+
+        static inline Constraint Check (
+            const Expression::Expr &expr)
+        {
+            return Constraint { "check (" + expr.ToString () + ")" };
+        }
+
+        template <typename T>
+        static inline Constraint Unique (
+            const Expression::Field<T> &field)
+        {
+            auto ret = Constraint { "unique (" + field.fieldName + ")" };
+            ret.unique = field.fieldName;
+            return ret;
+        }
+
+        static inline Constraint Unique (
+            const CompositeField &fields)
+        {
+            auto ret = Constraint { "unique (" + fields.fieldName + ")" };
+            ret.unique = fields.fieldName;
+            return ret;
+        }
+
+        template <typename T>
+        static inline Constraint PrimaryKey (
+            const Expression::Field<T> &field)
+        {
+            auto ret = Constraint { " primary key", field.fieldName };
+            ret.unique = field.fieldName;
+            ret.primaryKey = true;
+            return ret;
+        }
+
+        static inline Constraint PrimaryKey (
+            const CompositeField &fields)
+        {
+            auto ret = Constraint {
+                "primary key (" + fields.fieldName + ")" };
+            ret.unique = fields.fieldName;
+            ret.primaryKey = true;
+            return ret;
+        }
+
+        static inline Constraint FullText (
+            const Expression::Field<std::string> &field)
+        {
+            auto ret = Constraint { std::string {},
+                std::string {}, "fts_" + field.fieldName };
+            ret.fullText = field.fieldName;
+            return ret;
+        }
+
+        static inline Constraint Spatial (
+            const CompositeField &bounds)
+        {
+            auto count = BOT_ORM_Impl::SplitFields (
+                bounds.fieldName).size ();
+            if (count % 2 != 0 || count > 10)
+                throw std::runtime_error (BAD_SPATIAL);
+
+            auto ret = Constraint { std::string {},
+                std::string {}, "rtree_" + IndexName (bounds.fieldName) };
+            ret.spatial = bounds.fieldName;
+            return ret;
+        }
+
+        static inline Constraint Compressed (
+            const Expression::Field<std::string> &field)
+        {
+            auto ret = Constraint { std::string {}, field.fieldName };
+            ret.compressed = true;
+            return ret;
+        }
+
+        static inline Constraint WithoutRowid ()
+        {
+            return MakeOption ("without rowid");
+        }
+
+#if SQLITE_VERSION_NUMBER >= 3037000
+        static inline Constraint Strict ()
+        {
+            return MakeOption ("strict");
+        }
+#endif
+
+        template <typename T>
+        static inline Constraint Index (
+            const Expression::Field<T> &field)
+        {
+            return MakeIndex (field.fieldName);
+        }
+
+        template <typename T>
+        static inline Constraint Index (
+            const Expression::Function<T> &expr)
+        {
+            return MakeIndex (expr.columnExpr);
+        }
+
+        static inline Constraint Index (
+            const CompositeField &fields)
+        {
+            return MakeIndex (fields.fieldName);
+        }
+
+        template <typename T>
+        static inline Constraint Index (
+            const Expression::Field<T> &field,
+            const Expression::Expr &where)
+        {
+            return MakeIndex (field.fieldName, where);
+        }
+
+        template <typename T>
+        static inline Constraint Index (
+            const Expression::Function<T> &expr,
+            const Expression::Expr &where)
+        {
+            return MakeIndex (expr.columnExpr, where);
+        }
+
+        static inline Constraint Index (
+            const CompositeField &fields,
+            const Expression::Expr &where)
+        {
+            return MakeIndex (fields.fieldName, where);
+        }
+
+        template <typename T>
+        static inline Constraint Reference (
+            const Expression::Field<T> &field,
+            const Expression::Field<T> &refered)
+        {
+            return Constraint {
+                std::string ("foreign key (") + field.fieldName +
+                ") references " + *(refered.tableName) +
+                "(" + refered.fieldName + ")" };
+        }
+
+        static inline Constraint Reference (
+            const CompositeField &field,
+            const CompositeField &refered)
+        {
+            return Constraint {
+                std::string ("foreign key (") + field.fieldName +
+                ") references " + *(refered.tableName) +
+                "(" + refered.fieldName + ")" };
+        }
+    };
+
+    namespace Expression
+    {
+        // Spatial Search (by the Index of 'Constraint::Spatial')
+        // - 'box' is { low1, high1, low2, high2, ... }
+        // - R*Tree finds the Overlapping Candidates, which are Checked
+        //   again (as Bounds are Rounded Outwards to 32-bit Floats)
+
+        template <typename T>
+        inline Expr _SpatialExpr (const Constraint::CompositeField &bounds,
+            const std::vector<T> &box, bool within)
+        {
+            const auto fields = BOT_ORM_Impl::SplitFields (bounds.fieldName);
+            if (fields.size () != box.size () || fields.size () % 2 != 0)
+                throw std::runtime_error (BAD_BOX);
+
+            // Overlaps: min <= high and max >= low
+            // Within:   min >= low and max <= high
+            BOT_ORM_Impl::SQLWriter rtree, check;
+            for (size_t i = 0; i < fields.size (); i++)
+            {
+                const auto isMin = i % 2 == 0;
+                const auto &other = box[isMin ? i + 1 : i - 1];
+                rtree << (i ? " and " : "") << fields[i]
+                    << (isMin ? "<=" : ">=");
+                BOT_ORM_Impl::SerializationHelper::Serialize (rtree, other);
+
+                check << " and " << *(bounds.tableName) << '.' << fields[i]
+                    << (isMin == within ? ">=" : "<=");
+                BOT_ORM_Impl::SerializationHelper::Serialize (
+                    check, within ? box[i] : other);
+            }
+
+            return Expr { Selectable<T> { "rowid", bounds.tableName },
+                " in (select id from " + BOT_ORM_Impl::SpatialName (
+                    *(bounds.tableName), bounds.fieldName) +
+                " where " + rtree.Str () + ")" + check.Str () };
+        }
+
+        template <typename T>
+        inline Expr Overlaps (const Constraint::CompositeField &bounds,
+            const std::vector<T> &box)
+        {
+            return _SpatialExpr (bounds, box, false);
+        }
+
+        template <typename T>
+        inline Expr Within (const Constraint::CompositeField &bounds,
+            const std::vector<T> &box)
+        {
+            return _SpatialExpr (bounds, box, true);
+        }
+    }
+
+    template <typename T>
+    class Queryable;
+
+    // Result of Keyset Pagination
+
+    template <typename QueryResult>
+    struct Page
+    {
+        std::vector<QueryResult> rows;
+
+        // Pass to 'Queryable::Resume' for the Next Page
+        // (Empty if there is NO Row in this Page)
+        std::string nextToken;
+    };
+}
+
+namespace BOT_ORM_Impl
+{
+    // Why Remove QueryableHelper from Query?
+    // Query is a template but the Helper can be shared
+
+    class QueryableHelper
+    {
+        template <typename T>
+        using Nullable = BOT_ORM::Nullable<T>;
+
+        template <typename T>
+        using Selectable = BOT_ORM::Expression::Selectable<T>;
+
+    protected:
+        template <typename T>
+        friend class BOT_ORM::Queryable;
+
+        // #1 Tuple Visitor
+
+        // Apply 'Fn' to each of element of Tuple
+        template <typename Fn, typename TupleType, std::size_t... I>
+        static inline void TupleVisit_Impl (
+            TupleType &tuple, Fn fn, std::index_sequence<I...>)
+        {
+            (void) BOT_ORM_Impl::Expander
+            {
+                0, ((void) fn (std::get<I> (tuple)), 0)...
+            };
+        }
+
+        // Produce the 'index_sequence' for 'tuple'
+        template <typename Fn, typename TupleType>
+        static inline void TupleVisit (TupleType &tuple, Fn fn)
+        {
+            constexpr auto size = std::tuple_size<TupleType>::value;
+            return TupleVisit_Impl (tuple, fn,
+                std::make_index_sequence<size> {});
+        }
+
+        // #2 Join To Tuple
+
+        // Type To Nullable
+        // Get Nullable Type Wrappers for Non-nullable Types
+        template <typename T> struct TypeToNullable
+        {
+            using type = Nullable<T>;
+        };
+        template <typename T> struct TypeToNullable <Nullable<T>>
+        {
+            using type = Nullable<T>;
+        };
+
+        // Fields To Nullable
+        // Apply 'TypeToNullable' to each element of Fields
+        template <typename... Args>
+        static inline auto FieldsToNullable (Args...)
+        {
+            // Unpacking Tricks :-)
+            // Expand each of 'Args'
+            // with 'TypeToNullable_t<...>' as a sequence
+            return std::tuple<
+                typename TypeToNullable<Args>::type...
+            > {};
+        }
+
+        // QueryResult To Nullable
+        template <typename C>
+        static inline auto QueryResultToTuple (const C &arg)
+        {
+            return BOT_ORM_Impl::InjectionHelper::Visit (
+                arg, [] (auto ... args)
+            {
+                return FieldsToNullable (args...);
+            });
+        }
+
+        template <typename... Args>
+        static inline auto QueryResultToTuple (
+            const std::tuple<Args...>& t)
+        {
+            // FieldsToNullable is not necessary: Nullable already
+            return t;
+        }
+
+        // Construct Tuple from QueryResult List
+        template <typename... Args>
+        static inline auto JoinToTuple (const Args & ... args)
+        {
+            // Unpacking Tricks :-)
+            return decltype (std::tuple_cat (
+                QueryResultToTuple (args)...
+            )) {};
+        }
+
+        // #3 Select To Tuple
+
+        // Selectable To Tuple
+        template <typename T>
+        static inline auto SelectableToTuple (const Selectable<T> &)
+        {
+            // Notes: Only 'const Selectable<T> &' will overload...
+            return Nullable<T> {};
+        }
+
+        // Construct Tuple from Selectable<T> List
+        template <typename... Args>
+        static inline auto SelectToTuple (const Args & ... args)
+        {
+            // Unpacking Tricks :-)
+            return std::tuple <
+                decltype (SelectableToTuple (args))...
+            > {};
+        }
+
+        // #4 Field To SQL
+
+        // Return Field Strings for GroupBy, OrderBy and Select
+        template <typename T>
+        static inline std::string FieldToSql (const Selectable<T> &op)
+        {
+            if (op.tableName) return (*op.tableName) + "." + op.fieldName;
+            else return op.fieldName;
+        }
+        template <typename T, typename... Args>
+        static inline std::string FieldToSql (const Selectable<T> &arg,
+            const Args & ... args)
+        {
+            return FieldToSql (arg) + "," + FieldToSql (args...);
+        }
+    };
+}
+
+namespace BOT_ORM
+{
+    // Queryable
+
+    template <typename QueryResult>
+    class Queryable
+    {
+        template <typename C>
+        using HasInjected =
+            BOT_ORM_Impl::InjectionHelper::HasInjected<C>;
+
+    protected:
+        std::shared_ptr<BOT_ORM_Impl::SQLConnector> _connector;
+        QueryResult _queryHelper;
+
+        std::string _sqlFrom;
+        std::string _sqlSelect;
+        std::string _sqlTarget;
+
+        std::string _sqlWhere;
+        std::string _sqlGroupBy;
+        std::string _sqlHaving;
+
+        std::string _sqlOrderBy;
+        std::string _sqlLimit;
+        std::string _sqlOffset;
+
+        // Keyset Pagination
+        // - Fields of Order By and whether they are Descending
+        // - Condition to Seek after the Last Keys
+        std::vector<std::pair<std::string, bool>> _orderKeys;
+        std::string _sqlSeek;
+
+        // Deadline and Cancellation
+        BOT_ORM_Impl::QueryLimits _limits;
+
+        // Count of Connections to Scan in Parallel
+        size_t _parallelism = 1;
+
+        // Connections to Scan Partitions
+        std::shared_ptr<BOT_ORM_Impl::ReaderPool> _readers;
+
+        Queryable (
+            std::shared_ptr<BOT_ORM_Impl::SQLConnector> connector,
+            QueryResult queryHelper,
+            std::string sqlFrom,
+            std::string sqlSelect = "select ",
+            std::string sqlTarget = "*",
+            std::string sqlWhere = std::string {},
+            std::string sqlGroupBy = std::string {},
+            std::string sqlHaving = std::string {},
+            std::string sqlOrderBy = std::string {},
+            std::string sqlLimit = std::string {},
+            std::string sqlOffset = std::string {})
+            :
+            _connector (std::move (connector)),
+            _queryHelper (std::move (queryHelper)),
+            _sqlFrom (std::move (sqlFrom)),
+            _sqlSelect (std::move (sqlSelect)),
+            _sqlTarget (std::move (sqlTarget)),
+            _sqlWhere (std::move (sqlWhere)),
+            _sqlGroupBy (std::move (sqlGroupBy)),
+            _sqlHaving (std::move (sqlHaving)),
+            _sqlOrderBy (std::move (sqlOrderBy)),
+            _sqlLimit (std::move (sqlLimit)),
+            _sqlOffset (std::move (sqlOffset))
+        {}
+
+        template <typename Q> friend class Queryable;
+        friend class ORMapper;
+        friend class Snapshot;
+
+    public:
+        // Parallel Scan
+        inline Queryable Parallel (size_t n) const &
+        {
+            auto ret = *this;
+            ret._parallelism = n;
+            return ret;
+        }
+        inline Queryable Parallel (size_t n) &&
+        {
+            (*this)._parallelism = n;
+            return std::move (*this);
+        }
+
+        // Distinct
+        inline Queryable Distinct () const &
+        {
+            auto ret = *this;
+            ret._sqlSelect = "select distinct ";
+            return ret;
+        }
+        inline Queryable Distinct () &&
+        {
+            (*this)._sqlSelect = "select distinct ";
+            return std::move (*this);
+        }
+
+        // Deadline
+        inline Queryable WithTimeout (
+            std::chrono::milliseconds timeout) const &
+        {
+            auto ret = *this;
+            ret._limits.timeout = timeout;
+            return ret;
+        }
+        inline Queryable WithTimeout (
+            std::chrono::milliseconds timeout) &&
+        {
+            (*this)._limits.timeout = timeout;
+            return std::move (*this);
+        }
+
+        // Cancellation
+        inline Queryable WithCancellation (
+            const CancellationToken &token) const &
+        {
+            auto ret = *this;
+            ret._limits.cancelled = token._cancelled;
+            return ret;
+        }
+        inline Queryable WithCancellation (
+            const CancellationToken &token) &&
+        {
+            (*this)._limits.cancelled = token._cancelled;
+            return std::move (*this);
+        }
+
+        // Where
+        inline Queryable Where (const Expression::Expr &expr) const &
+        {
+            auto ret = *this;
+            ret._sqlWhere = " where (" + expr.ToString () + ")";
+            return ret;
+        }
+        inline Queryable Where (const Expression::Expr &expr) &&
+        {
+            (*this)._sqlWhere = " where (" + expr.ToString () + ")";
+            return std::move (*this);
+        }
+
+        // Full-text Search (by the Index of 'Constraint::FullText')
+        // - Join the Index Once, so 'Rank (field)' is Read from the Join
+        inline Queryable Search (const Expression::Field<std::string> &field,
+            const std::string &query) const &
+        {
+            auto ret = *this;
+            ret._JoinFullText (field, query);
+            return ret;
+        }
+        inline Queryable Search (const Expression::Field<std::string> &field,
+            const std::string &query) &&
+        {
+            (*this)._JoinFullText (field, query);
+            return std::move (*this);
+        }
+
+        // Group By
+        template <typename T>
+        inline Queryable GroupBy (const Expression::Field<T> &field) const &
+        {
+            auto ret = *this;
+            ret._sqlGroupBy = " group by " +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
+            return ret;
+        }
+        template <typename T>
+        inline Queryable GroupBy (const Expression::Field<T> &field) &&
+        {
+            (*this)._sqlGroupBy = " group by " +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
+            return std::move (*this);
+        }
+
+        // Having
+        inline Queryable Having (const Expression::Expr &expr) const &
+        {
+            auto ret = *this;
+            ret._sqlHaving = " having " + expr.ToString ();
+            return ret;
+        }
+        inline Queryable Having (const Expression::Expr &expr) &&
+        {
+            (*this)._sqlHaving = " having " + expr.ToString ();
+            return std::move (*this);
+        }
+
+        // Limit
+        inline Queryable Take (size_t count) const &
+        {
+            auto ret = *this;
+            ret._sqlLimit = " limit " + std::to_string (count);
+            return ret;
+        }
+        inline Queryable Take (size_t count) &&
+        {
+            (*this)._sqlLimit = " limit " + std::to_string (count);
+            return std::move (*this);
+        }
+
+        // Offset
+        inline Queryable Skip (size_t count) const &
+        {
+            auto ret = *this;
+            if (ret._sqlLimit.empty ())
+                ret._sqlLimit = " limit ~0";  // ~0 is a trick :-)
+            ret._sqlOffset = " offset " + std::to_string (count);
+            return ret;
+        }
+        inline Queryable Skip (size_t count) &&
+        {
+            if ((*this)._sqlLimit.empty ())
+                (*this)._sqlLimit = " limit ~0";  // ~0 is a trick :-)
+            (*this)._sqlOffset = " offset " + std::to_string (count);
+            return std::move (*this);
+        }
+
+        // Order By
+        template <typename T>
+        inline Queryable OrderBy (
+            const Expression::Selectable<T> &field) const &
+        {
+            auto ret = *this;
+            ret._orderKeys.emplace_back (
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field), false);
+            if (ret._sqlOrderBy.empty ())
+                ret._sqlOrderBy = " order by " +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
+            else
+                ret._sqlOrderBy += "," +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
+            return ret;
+        }
+        template <typename T>
+        inline Queryable OrderBy (
+            const Expression::Selectable<T> &field) &&
+        {
+            (*this)._orderKeys.emplace_back (
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field), false);
+            if ((*this)._sqlOrderBy.empty ())
+                (*this)._sqlOrderBy = " order by " +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
+            else
+                (*this)._sqlOrderBy += "," +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field);
+            return std::move (*this);
+        }
+
+        // Order By Desc
+        template <typename T>
+        inline Queryable OrderByDescending (
+            const Expression::Selectable<T> &field) const &
+        {
+            auto ret = *this;
+            ret._orderKeys.emplace_back (
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field), true);
+            if (ret._sqlOrderBy.empty ())
+                ret._sqlOrderBy = " order by " +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
+            else
+                ret._sqlOrderBy += "," +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
+            return ret;
+        }
+        template <typename T>
+        inline Queryable OrderByDescending (
+            const Expression::Selectable<T> &field) &&
+        {
+            (*this)._orderKeys.emplace_back (
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field), true);
+            if ((*this)._sqlOrderBy.empty ())
+                (*this)._sqlOrderBy = " order by " +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
+            else
+                (*this)._sqlOrderBy += "," +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (field) + " desc";
+            return std::move (*this);
+        }
+
+        // Seek after the Last Keys of Order By
+        template <typename... Args>
+        inline Queryable SeekAfter (const Args & ... lastKeys) const &
+        {
+            auto ret = *this;
+            ret._SetSeek (_SerializeKeys (lastKeys...));
+            return ret;
+        }
+        template <typename... Args>
+        inline Queryable SeekAfter (const Args & ... lastKeys) &&
+        {
+            (*this)._SetSeek (_SerializeKeys (lastKeys...));
+            return std::move (*this);
+        }
+
+        // Order By 'field' and Seek after 'lastKey'
+        template <typename T>
+        inline Queryable After (const Expression::Field<T> &field,
+            const T &lastKey) const &
+        {
+            return OrderBy (field).SeekAfter (lastKey);
+        }
+        template <typename T>
+        inline Queryable After (const Expression::Field<T> &field,
+            const T &lastKey) &&
+        {
+            return std::move (*this).OrderBy (field).SeekAfter (lastKey);
+        }
+
+        // Seek after the Page of 'pageToken' (No Effect if Empty)
+        inline Queryable Resume (const std::string &pageToken) const &
+        {
+            auto ret = *this;
+            if (!pageToken.empty ())
+                ret._SetSeek (_ParsePageToken (pageToken));
+            return ret;
+        }
+        inline Queryable Resume (const std::string &pageToken) &&
+        {
+            if (!pageToken.empty ())
+                (*this)._SetSeek (_ParsePageToken (pageToken));
+            return std::move (*this);
+        }
+
+        // Select
+        template <typename... Args>
+        inline auto Select (const Args & ... args) const
+        {
+            return _NewQuery (
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (args...),
+                _sqlFrom,
+                BOT_ORM_Impl::QueryableHelper::SelectToTuple (args...)
+            );
+        }
+
+        // Join
+        template <typename C>
+        inline auto Join (const C &,
+            const Expression::Expr &,
+            std::enable_if_t<
+            !HasInjected<C>::value>
+            * = nullptr) const
+        {}
+        template <typename C>
+        inline auto Join (const C &queryHelper2,
+            const Expression::Expr &onExpr,
+            std::enable_if_t<
+            HasInjected<C>::value>
+            * = nullptr) const
+        {
+            return _NewJoinQuery (queryHelper2,
+                BOT_ORM_Impl::InjectionHelper::TableName (queryHelper2),
+                onExpr, " join ");
+        }
+
+        template <typename C>
+        inline auto Join (const NamedTable<C> &table2,
+            const Expression::Expr &onExpr,
+            std::enable_if_t<
+            HasInjected<C>::value>
+            * = nullptr) const
+        {
+            return _NewJoinQuery (table2.helper, table2.tableName,
+                onExpr, " join ");
+        }
+
+        // Left Join
+        template <typename C>
+        inline auto LeftJoin (const C &,
+            const Expression::Expr &,
+            std::enable_if_t<
+            !HasInjected<C>::value>
+            * = nullptr) const
+        {}
+        template <typename C>
+        inline auto LeftJoin (const C &queryHelper2,
+            const Expression::Expr &onExpr,
+            std::enable_if_t<
+            HasInjected<C>::value>
+            * = nullptr) const
+        {
+            return _NewJoinQuery (queryHelper2,
+                BOT_ORM_Impl::InjectionHelper::TableName (queryHelper2),
+                onExpr, " left join ");
+        }
+        template <typename C>
+        inline auto LeftJoin (const NamedTable<C> &table2,
+            const Expression::Expr &onExpr,
+            std::enable_if_t<
+            HasInjected<C>::value>
+            * = nullptr) const
+        {
+            return _NewJoinQuery (table2.helper, table2.tableName,
+                onExpr, " left join ");
+        }
+
+        // Compound Select
+        inline Queryable Union (const Queryable &queryable) const
+        {
+            return _NewCompoundQuery (queryable, " union ");
+        }
+        inline Queryable UnionAll (Queryable queryable) const
+        {
+            return _NewCompoundQuery (queryable, " union all ");
+        }
+        inline Queryable Intersect (Queryable queryable) const
+        {
+            return _NewCompoundQuery (queryable, " intersect ");
+        }
+        inline Queryable Except (Queryable queryable) const
+        {
+            return _NewCompoundQuery (queryable, " excpet ");
+        }
+
+        // Get Result
+        template <typename T>
+        Nullable<T> Aggregate (const Expression::Aggregate<T> &agg) const
+        {
+            auto function = agg.fieldName.substr (
+                0, agg.fieldName.find_first_of (" ("));
+            if (std::is_arithmetic<T>::value && (
+                function == "count" || function == "sum" ||
+                function == "avg" || function == "min" || function == "max"))
+            {
+                std::shared_ptr<BOT_ORM_Impl::ReaderPool> readers;
+                auto partitions = _GetPartitions (readers);
+                if (!partitions.empty ())
+                    return _ParallelAggregate<T> (readers,
+                        function, agg.fieldName, partitions,
+                        std::is_arithmetic<T> {});
+            }
+
+            Nullable<T> ret;
+            _connector->ExecuteQuery (_sqlSelect + agg.fieldName +
+                _GetFromSql () + _GetLimit () + ";",
+                [&] (int argc, const BOT_ORM_Impl::ColumnValue *argv)
+            {
+                if (argc != 1)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+
+                BOT_ORM_Impl::DeserializationHelper::
+                    Deserialize (ret, argv[0]);
+            }, _IsFullRead (), _limits);
+            return ret;
+        }
+
+        // Get Results of Aggregates in one Pass
+        template <typename T1, typename T2, typename... Args>
+        std::tuple<Nullable<T1>, Nullable<T2>, Nullable<Args>...>
+            Aggregate (const Expression::Aggregate<T1> &agg1,
+                const Expression::Aggregate<T2> &agg2,
+                const Expression::Aggregate<Args> & ... aggs) const
+        {
+            std::tuple<Nullable<T1>, Nullable<T2>, Nullable<Args>...> ret;
+            _connector->ExecuteQuery (_sqlSelect +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (
+                    agg1, agg2, aggs...) +
+                _GetFromSql () + _GetLimit () + ";",
+                [&] (int argc, const BOT_ORM_Impl::ColumnValue *argv)
+            {
+                _Deserialize (ret, argc, argv);
+            }, _IsFullRead (), _limits);
+            return ret;
+        }
+
+        // Get Results of Aggregates for each Group of 'key'
+        // - Groups of 'NULL' key are Skipped
+        template <typename K, typename... Args>
+        std::unordered_map<K, std::tuple<Nullable<Args>...>>
+            GroupAggregate (const Expression::Field<K> &key,
+                const Expression::Aggregate<Args> & ... aggs) const
+        {
+            std::unordered_map<K, std::tuple<Nullable<Args>...>> ret;
+            _GroupAggregate (ret, key, aggs...);
+            return ret;
+        }
+        template <typename K, typename... Args>
+        std::unordered_map<Nullable<K>, std::tuple<Nullable<Args>...>>
+            GroupAggregate (const Expression::NullableField<K> &key,
+                const Expression::Aggregate<Args> & ... aggs) const
+        {
+            std::unordered_map<Nullable<K>,
+                std::tuple<Nullable<Args>...>> ret;
+            _GroupAggregate (ret, key, aggs...);
+            return ret;
+        }
+
+        std::vector<QueryResult> ToVector () const
+        {
+            std::vector<QueryResult> ret;
+            _Select (ret);
+            return ret;
+        }
+        std::list<QueryResult> ToList () const
+        {
+            std::list<QueryResult> ret;
+            _Select (ret);
+            return ret;
+        }
+
+        // Keyset Pagination
+        Page<QueryResult> ToPage () const
+        {
+            if (_orderKeys.empty ())
+                throw std::runtime_error (NO_ORDER);
+
+            // Retrieve the Keys as SQL Literals
+            auto sqlTarget = _sqlTarget;
+            for (const auto &key : _orderKeys)
+                sqlTarget += ",quote(" + key.first + ")";
+
+            Page<QueryResult> ret;
+            std::vector<std::string> lastKeys;
+            auto copy = _queryHelper;
+            const auto keyCount = (int) _orderKeys.size ();
+
+            _connector->ExecuteQuery (_sqlSelect + sqlTarget +
+                _GetFromSql () + _GetLimit () + ";",
+                [&] (int argc, const BOT_ORM_Impl::ColumnValue *argv)
+            {
+                if (argc < keyCount)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+
+                _Deserialize (copy, argc - keyCount, argv);
+                ret.rows.push_back (copy);
+                lastKeys.clear ();
+                for (auto i = argc - keyCount; i < argc; i++)
+                    lastKeys.emplace_back ((const char *)
+                        sqlite3_column_text (argv[i].stmt, i));
+            }, _IsFullRead (), _limits);
+
+            for (const auto &key : lastKeys)
+                ret.nextToken += key + ",";
+            if (!ret.nextToken.empty ())
+                ret.nextToken.pop_back ();
+            return ret;
+        }
+
+        // Query Plan of 'ToVector' / 'ToList'
+        std::vector<QueryPlan> Explain () const
+        {
+            return _connector->Explain (_GetSql ());
+        }
+
+    protected:
+        // Return FROM part for Query
+        inline std::string _GetFromSql () const
+        {
+            return _sqlFrom + _GetWhere () + _sqlGroupBy + _sqlHaving;
+        }
+
+        // Return WHERE part with Seek Condition
+        inline std::string _GetWhere () const
+        {
+            if (_sqlSeek.empty ())
+                return _sqlWhere;
+            else if (_sqlWhere.empty ())
+                return " where (" + _sqlSeek + ")";
+            else
+                return _sqlWhere + " and (" + _sqlSeek + ")";
+        }
+
+        // Return ORDER BY & LIMIT part for Query
+        inline std::string _GetLimit () const
+        {
+            return _sqlOrderBy + _sqlLimit + _sqlOffset;
+        }
+
+        // Return the whole Query
+        inline std::string _GetSql () const
+        {
+            return _sqlSelect + _sqlTarget +
+                _GetFromSql () + _GetLimit () + ";";
+        }
+
+        // Reading the whole Table is Expected without Filters
+        void _JoinFullText (const Expression::Field<std::string> &field,
+            const std::string &query)
+        {
+            const auto &table = *(field.tableName);
+            auto index = BOT_ORM_Impl::FullTextName (table, field.fieldName);
+
+            BOT_ORM_Impl::SQLWriter os;
+            os << " join " << index << " on " << index << ".rowid="
+                << table << ".rowid and " << index << " match ";
+            os.Quote (query);
+            _sqlFrom += os.Release ();
+
+            // Columns of the Index are NOT Retrieved
+            if (_sqlTarget == "*")
+                _sqlTarget = table + ".*";
+        }
+
+        inline bool _IsFullRead () const
+        {
+            return _sqlWhere.empty () && _sqlSeek.empty () &&
+                _sqlHaving.empty ();
+        }
+
+        // Serialize Keys into SQL Literals ('null' for Null Keys)
+        template <typename... Args>
+        static inline std::vector<std::string> _SerializeKeys (
+            const Args & ... keys)
+        {
+            std::vector<std::string> ret;
+            auto serializeKey = [&ret] (const auto &key)
+            {
+                BOT_ORM_Impl::SQLWriter os;
+                if (_IsNullKey (key))
+                    os << "null";
+                else if (!BOT_ORM_Impl::SerializationHelper::
+                    Serialize (os, key))
+                    throw std::runtime_error (BAD_SEEK_KEY);
+                ret.emplace_back (os.Release ());
+            };
+            (void) BOT_ORM_Impl::Expander
+            {
+                0, (serializeKey (keys), 0)...
+            };
+            (void) serializeKey;
+            return ret;
+        }
+
+        template <typename T>
+        static inline bool _IsNullKey (const T &)
+        {
+            return false;
+        }
+        template <typename T>
+        static inline bool _IsNullKey (const Nullable<T> &key)
+        {
+            return key == nullptr;
+        }
+
+        // Split 'pageToken' into SQL Literals, accepting only
+        // Numbers, Quoted Strings, Blobs (x'...') and Null
+        static std::vector<std::string> _ParsePageToken (
+            const std::string &pageToken)
+        {
+            std::vector<std::string> ret;
+            size_t pos = 0;
+            while (pos < pageToken.size ())
+            {
+                auto begin = pos;
+                if (pageToken[pos] == '\'')
+                {
+                    // Quoted String with '' as Escaped '
+                    for (pos++; ; pos += 2)
+                    {
+                        pos = pageToken.find ('\'', pos);
+                        if (pos == std::string::npos)
+                            throw std::runtime_error (BAD_PAGE_TOKEN);
+                        if (pos + 1 == pageToken.size () ||
+                            pageToken[pos + 1] != '\'')
+                            break;
+                    }
+                    pos++;
+                }
+                else if ((pageToken[pos] == 'x' || pageToken[pos] == 'X') &&
+                    pos + 1 < pageToken.size () && pageToken[pos + 1] == '\'')
+                {
+                    // Blob of Hex Digits
+                    for (pos += 2; pos < pageToken.size () &&
+                        isxdigit ((unsigned char) pageToken[pos]); pos++);
+                    if (pos == pageToken.size () || pageToken[pos] != '\'' ||
+                        (pos - begin) % 2 != 0)
+                        throw std::runtime_error (BAD_PAGE_TOKEN);
+                    pos++;
+                }
+                else if (pageToken.compare (pos, 4, "NULL") == 0 ||
+                    pageToken.compare (pos, 4, "null") == 0)
+                {
+                    pos += 4;
+                    ret.emplace_back ("null");
+                    if (pos < pageToken.size () && pageToken[pos++] != ',')
+                        throw std::runtime_error (BAD_PAGE_TOKEN);
+                    continue;
+                }
+                else
+                    pos = _ScanNumber (pageToken, pos);
+                ret.emplace_back (pageToken.substr (begin, pos - begin));
+
+                if (pos < pageToken.size () && pageToken[pos++] != ',')
+                    throw std::runtime_error (BAD_PAGE_TOKEN);
+            }
+            return ret;
+        }
+
+        // End of the Numeric Literal at 'pos' of 'token':
+        // [-] digits [. digits] [e [+|-] digits]
+        static size_t _ScanNumber (const std::string &token, size_t pos)
+        {
+            auto scanDigits = [&token, &pos] ()
+            {
+                auto begin = pos;
+                while (pos < token.size () &&
+                    isdigit ((unsigned char) token[pos]))
+                    pos++;
+                if (pos == begin)
+                    throw std::runtime_error (BAD_PAGE_TOKEN);
+            };
+
+            if (pos < token.size () && token[pos] == '-')
+                pos++;
+            scanDigits ();
+            if (pos < token.size () && token[pos] == '.')
+            {
+                pos++;
+                scanDigits ();
+            }
+            if (pos < token.size () && (token[pos] == 'e' || token[pos] == 'E'))
+            {
+                pos++;
+                if (pos < token.size () &&
+                    (token[pos] == '+' || token[pos] == '-'))
+                    pos++;
+                scanDigits ();
+            }
+            return pos;
+        }
+
+        // Rows after 'lastKeys' in the Order of '_orderKeys':
+        // k1 >= v1 and (k1 > v1 or (k1 = v1 and (k2 > v2 or ...)))
+        // (the Leading Term lets the Index Seek to v1 directly)
+        // - Null is the Smallest Key, as Ordered by SQLite
+        //   (First in Ascending Order, Last in Descending Order)
+        inline void _SetSeek (const std::vector<std::string> &lastKeys)
+        {
+            if (_orderKeys.empty ())
+                throw std::runtime_error (NO_ORDER);
+            if (lastKeys.size () != _orderKeys.size ())
+                throw std::runtime_error (BAD_SEEK_KEY);
+
+            std::string sqlSeek;
+            for (size_t i = lastKeys.size (); i-- > 0; )
+            {
+                const auto &key = _orderKeys[i].first;
+                auto after = _SeekTerm (key, _orderKeys[i].second,
+                    lastKeys[i], false);
+                if (sqlSeek.empty ())
+                    sqlSeek = std::move (after);
+                else
+                    sqlSeek = "(" + after + " or (" +
+                    (lastKeys[i] == "null" ? key + " is null" :
+                        key + "=" + lastKeys[i]) +
+                    " and " + sqlSeek + "))";
+            }
+
+            auto leading = _SeekTerm (_orderKeys[0].first,
+                _orderKeys[0].second, lastKeys[0], true);
+            _sqlSeek = leading.empty () ? sqlSeek :
+                leading + " and " + sqlSeek;
+        }
+
+        // Rows after ('orEqual' or at) 'lastKey' of 'key'
+        // (Empty if All Rows)
+        static std::string _SeekTerm (const std::string &key,
+            bool isDesc, const std::string &lastKey, bool orEqual)
+        {
+            if (lastKey == "null")
+            {
+                if (isDesc)
+                    return orEqual ? key + " is null" : "0";
+                return orEqual ? std::string {} : key + " is not null";
+            }
+
+            auto op = std::string (isDesc ? "<" : ">") + (orEqual ? "=" : "");
+            if (isDesc)
+                return "(" + key + op + lastKey + " or " +
+                    key + " is null)";
+            return key + op + lastKey;
+        }
+
+        // Table of Plain Queries
+        template <typename C>
+        static inline const std::string *_GetTable (const C &queryHelper)
+        {
+            return &BOT_ORM_Impl::InjectionHelper::TableName (queryHelper);
+        }
+        template <typename... Args>
+        static inline const std::string *_GetTable (
+            const std::tuple<Args...> &)
+        {
+            return nullptr;
+        }
+
+        // Rowid Ranges to Scan in Parallel
+        // - Empty if the Query can NOT be Partitioned, that is NOT
+        //   a Plain Query on a Rowid Table of a Database File
+        //   (or with Distinct / GroupBy / OrderBy / Take / Skip)
+        // - Empty if the Partitions can NOT Read a Consistent Snapshot,
+        //   that is in a Transaction (whose Changes are Invisible to
+        //   other Connections) or NOT in WAL Mode
+        // - 'readers' is Set to the Pool Pinned to the Snapshot
+        std::vector<std::string> _GetPartitions (
+            std::shared_ptr<BOT_ORM_Impl::ReaderPool> &readers) const
+        {
+            std::vector<std::string> ret;
+            const auto *table = _GetTable (_queryHelper);
+            if (_parallelism < 2 || table == nullptr ||
+                _sqlFrom != " from " + *table ||
+                _sqlSelect != "select " || !_sqlGroupBy.empty () ||
+                !_sqlHaving.empty () || !_GetLimit ().empty () ||
+                _connector->FileName ().empty ())
+                return ret;
+
+            // Queries of a 'Snapshot' are Pinned already
+            readers = _readers ? _readers :
+                std::make_shared<BOT_ORM_Impl::ReaderPool> (
+                    _connector->FileName ());
+            if (!readers->IsPinned ())
+            {
+                if (_connector->InTransaction ())
+                    return ret;
+                readers = readers->Pin ();
+                if (!readers)
+                    return ret;
+            }
+
+            auto anyRow = false;
+            long long minRowid = 0, maxRowid = 0;
+            try
+            {
+                readers->Acquire ()->ExecuteCallback (
+                    "select min(_rowid_),max(_rowid_) from " +
+                    *table + ";", [&] (int argc, char **argv)
+                {
+                    if (argc != 2)
+                        throw std::runtime_error (BAD_COLUMN_COUNT);
+                    if (argv[0] == nullptr || argv[1] == nullptr)
+                        return;
+
+                    anyRow = true;
+                    minRowid = std::stoll (argv[0]);
+                    maxRowid = std::stoll (argv[1]);
+                });
+            }
+            catch (const std::exception &)
+            {
+                return ret;  // Table without Rowid
+            }
+            if (!anyRow)
+                return ret;
+
+            auto span = std::uint64_t (maxRowid) - std::uint64_t (minRowid);
+            auto step = span / _parallelism + 1;
+            for (std::uint64_t offset = 0; offset <= span; offset += step)
+            {
+                auto low = (long long) (std::uint64_t (minRowid) + offset);
+                auto high = span - offset < step
+                    ? maxRowid : (long long) (low + step - 1);
+                ret.push_back (*table + "._rowid_ between " +
+                    std::to_string (low) + " and " + std::to_string (high));
+                if (span - offset < step)
+                    break;
+            }
+            return ret;
+        }
+
+        // Run the Query of each Partition on a Connection of 'readers'
+        // - Call 'fn (partition, argc, argv)' on each Row
+        // - Rethrow the First Error after All Partitions End
+        template <typename Fn>
+        void _RunPartitions (
+            const std::shared_ptr<BOT_ORM_Impl::ReaderPool> &readers,
+            const std::string &sqlHead,
+            const std::vector<std::string> &partitions, Fn fn) const
+        {
+            const auto where = _GetWhere ();
+
+            std::vector<std::exception_ptr> errors (partitions.size ());
+            std::vector<std::thread> workers;
+            for (size_t i = 0; i < partitions.size (); i++)
+                workers.emplace_back ([&, i]
+            {
+                try
+                {
+                    auto connector = readers->Acquire ();
+                    connector->ExecuteQuery (sqlHead + _sqlFrom +
+                        (where.empty () ? " where (" : where + " and (") +
+                        partitions[i] + ");",
+                        [&fn, i] (int argc,
+                            const BOT_ORM_Impl::ColumnValue *argv)
+                    {
+                        fn (i, argc, argv);
+                    }, false, _limits);
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception ();
+                }
+            });
+
+            for (auto &worker : workers)
+                worker.join ();
+            for (const auto &error : errors)
+                if (error)
+                    std::rethrow_exception (error);
+        }
+
+        // Combine Partial Aggregates of Partitions
+        // ('avg' is Computed from 'sum' and 'count')
+        // - Only Arithmetic Results can be Combined
+        template <typename T>
+        Nullable<T> _ParallelAggregate (
+            const std::shared_ptr<BOT_ORM_Impl::ReaderPool> &,
+            const std::string &, const std::string &,
+            const std::vector<std::string> &, std::false_type) const
+        {
+            return nullptr;
+        }
+        template <typename T>
+        Nullable<T> _ParallelAggregate (
+            const std::shared_ptr<BOT_ORM_Impl::ReaderPool> &readers,
+            const std::string &function, const std::string &expr,
+            const std::vector<std::string> &partitions,
+            std::true_type) const
+        {
+            const auto args = expr.substr (function.size ());
+            if (function == "avg")
+            {
+                std::vector<std::pair<long double, size_t>> partials (
+                    partitions.size (), std::make_pair (0.0L, size_t (0)));
+                _RunPartitions (readers,
+                    _sqlSelect + "sum" + args + ",count" + args,
+                    partitions, [&partials] (size_t i, int argc,
+                        const BOT_ORM_Impl::ColumnValue *argv)
+                {
+                    if (argc != 2)
+                        throw std::runtime_error (BAD_COLUMN_COUNT);
+
+                    Nullable<long double> sum;
+                    BOT_ORM_Impl::DeserializationHelper::
+                        Deserialize (sum, argv[0]);
+                    if (sum == nullptr)
+                        return;
+                    partials[i].first = sum.Value ();
+                    BOT_ORM_Impl::DeserializationHelper::
+                        Deserialize (partials[i].second, argv[1]);
+                });
+
+                auto sum = 0.0L;
+                size_t count = 0;
+                for (const auto &partial : partials)
+                {
+                    sum += partial.first;
+                    count += partial.second;
+                }
+                if (count == 0)
+                    return nullptr;
+                return T (sum / count);
+            }
+
+            std::vector<Nullable<T>> partials (partitions.size ());
+            _RunPartitions (readers, _sqlSelect + expr,
+                partitions, [&partials] (size_t i, int argc,
+                    const BOT_ORM_Impl::ColumnValue *argv)
+            {
+                if (argc != 1)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+
+                BOT_ORM_Impl::DeserializationHelper::
+                    Deserialize (partials[i], argv[0]);
+            });
+
+            Nullable<T> ret;
+            for (const auto &partial : partials)
+            {
+                if (partial == nullptr)
+                    continue;
+                else if (ret == nullptr)
+                    ret = partial;
+                else if (function == "min")
+                    ret = std::min (ret.Value (), partial.Value ());
+                else if (function == "max")
+                    ret = std::max (ret.Value (), partial.Value ());
+                else  // count / sum
+                    ret = T (ret.Value () + partial.Value ());
+            }
+            return ret;
+        }
+
+        // Return a new Queryable Object
+        template <typename... Args>
+        inline Queryable<std::tuple<Args...>> _NewQuery (
+            std::string sqlTarget,
+            std::string sqlFrom,
+            std::tuple<Args...> &&newQueryHelper) const
+        {
+            auto ret = Queryable<std::tuple<Args...>> (
+                _connector, newQueryHelper,
+                std::move (sqlFrom),
+                _sqlSelect, std::move (sqlTarget),
+                _sqlWhere, _sqlGroupBy, _sqlHaving,
+                _sqlOrderBy, _sqlLimit, _sqlOffset);
+            ret._orderKeys = _orderKeys;
+            ret._sqlSeek = _sqlSeek;
+            ret._limits = _limits;
+            ret._readers = _readers;
+            return ret;
+        }
+
+        // Return a new Join Queryable Object
+        template <typename C>
+        inline auto _NewJoinQuery (const C &queryHelper2,
+            const std::string &tableName2,
+            const Expression::Expr &onExpr,
+            std::string joinStr) const
+        {
+            return _NewQuery (
+                _sqlTarget,
+                _sqlFrom + std::move (joinStr) + tableName2 +
+                " on " + onExpr.ToString (),
+                BOT_ORM_Impl::QueryableHelper::JoinToTuple (
+                    _queryHelper, queryHelper2));
+        }
+
+        // Return a new Compound Queryable Object
+        Queryable _NewCompoundQuery (const Queryable &queryable,
+            std::string compoundStr) const
+        {
+            auto ret = *this;
+            ret._sqlFrom = ret._GetFromSql () +
+                std::move (compoundStr) +
+                queryable._sqlSelect + queryable._sqlTarget +
+                queryable._GetFromSql ();
+            ret._sqlWhere.clear ();
+            ret._sqlSeek.clear ();
+            ret._sqlGroupBy.clear ();
+            ret._sqlHaving.clear ();
+            return ret;
+        }
+
+        // Groups are Refined by 'key' if Grouped already,
+        // so 'key' must Identify the Groups of 'GroupBy'
+        template <typename Map, typename K, typename... Args>
+        void _GroupAggregate (Map &ret, const Expression::Field<K> &key,
+            const Expression::Aggregate<Args> & ... aggs) const
+        {
+            const auto keySql =
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (key);
+            const auto groupBy = _sqlGroupBy.empty ()
+                ? " group by " + keySql : _sqlGroupBy + "," + keySql;
+
+            Nullable<K> groupKey;
+            std::tuple<Nullable<Args>...> groupValue;
+            _connector->ExecuteQuery (_sqlSelect + keySql + "," +
+                BOT_ORM_Impl::QueryableHelper::FieldToSql (aggs...) +
+                _sqlFrom + _GetWhere () + groupBy +
+                _sqlHaving + _GetLimit () + ";",
+                [&] (int argc, const BOT_ORM_Impl::ColumnValue *argv)
+            {
+                if (argc < 1)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+
+                BOT_ORM_Impl::DeserializationHelper::
+                    Deserialize (groupKey, argv[0]);
+                typename Map::key_type mapKey;
+                if (!_ToGroupKey (groupKey, mapKey))
+                    return;
+
+                _Deserialize (groupValue, argc - 1, argv + 1);
+                if (!ret.emplace (std::move (mapKey), groupValue).second)
+                    throw std::runtime_error (BAD_GROUP_KEY);
+            }, _IsFullRead (), _limits);
+        }
+
+        // Return false if 'NULL' can't be a Key
+        template <typename K>
+        static inline bool _ToGroupKey (const Nullable<K> &value, K &key)
+        {
+            if (value == nullptr)
+                return false;
+            key = value.Value ();
+            return true;
+        }
+        template <typename K>
+        static inline bool _ToGroupKey (const Nullable<K> &value,
+            Nullable<K> &key)
+        {
+            key = value;
+            return true;
+        }
+
+        // Deserialize a Row into Normal Objects
+        template <typename C>
+        static inline void _Deserialize (C &copy, int argc,
+            const BOT_ORM_Impl::ColumnValue *argv)
+        {
+            BOT_ORM_Impl::InjectionHelper::Visit (
+                copy, [argc] (auto & ... args)
+            {
+                if (sizeof... (args) != argc)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+            });
+
+            BOT_ORM_Impl::InjectionHelper::Visit (
+                copy, [argv] (auto & ... args)
+            {
+                size_t index = 0;
+                (void) BOT_ORM_Impl::Expander
+                {
+                    0, (BOT_ORM_Impl::DeserializationHelper::
+                        Deserialize (args, argv[index++]), 0)...
+                };
+            });
+        }
+
+        // Deserialize a Row into Tuples
+        template <typename... Args>
+        static inline void _Deserialize (std::tuple<Args...> &copy,
+            int argc, const BOT_ORM_Impl::ColumnValue *argv)
+        {
+            if (sizeof... (Args) != argc)
+                throw std::runtime_error (BAD_COLUMN_COUNT);
+
+            size_t index = 0;
+            BOT_ORM_Impl::QueryableHelper::TupleVisit (
+                copy, [argv, &index] (auto &val)
+            {
+                BOT_ORM_Impl::DeserializationHelper::
+                    Deserialize (val, argv[index++]);
+            });
+        }
+
+        template <typename Out>
+        inline void _Select (Out &out) const
+        {
+            std::shared_ptr<BOT_ORM_Impl::ReaderPool> readers;
+            auto partitions = _GetPartitions (readers);
+            if (!partitions.empty ())
+            {
+                std::vector<QueryResult> copies (
+                    partitions.size (), _queryHelper);
+                std::vector<std::vector<QueryResult>> results (
+                    partitions.size ());
+                _RunPartitions (readers,
+                    _sqlSelect + _sqlTarget, partitions,
+                    [&copies, &results] (size_t i, int argc,
+                        const BOT_ORM_Impl::ColumnValue *argv)
+                {
+                    _Deserialize (copies[i], argc, argv);
+                    results[i].push_back (copies[i]);
+                });
+
+                // Merge in Rowid Order
+                for (auto &result : results)
+                    for (auto &row : result)
+                        out.push_back (std::move (row));
+                return;
+            }
+
+            auto copy = _queryHelper;
+            _connector->ExecuteQuery (_GetSql (),
+                [&] (int argc, const BOT_ORM_Impl::ColumnValue *argv)
+            {
+                _Deserialize (copy, argc, argv);
+                out.push_back (copy);
+            }, _IsFullRead (), _limits);
+        }
+    };
+
+    // Snapshot
+    // - Queries see the Database as it was when the Snapshot was Taken
+    //   (including the Partitions of Parallel Scans)
+
+    class Snapshot
+    {
+        template <typename C>
+        using HasInjected =
+            BOT_ORM_Impl::InjectionHelper::HasInjected<C>;
+
+    public:
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value, Queryable<C>>
+            Query (C)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value, Queryable<C>>
+            Query (C queryHelper)
+        {
+            auto ret = Queryable<C> (
+                _readers->Acquire (),
+                std::move (queryHelper),
+                std::string (" from ") +
+                BOT_ORM_Impl::InjectionHelper::TableName (queryHelper));
+            ret._readers = _readers;
+            return ret;
+        }
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value, Queryable<C>>
+            Query (const NamedTable<C> &table)
+        {
+            auto ret = Queryable<C> (
+                _readers->Acquire (), table.helper,
+                std::string (" from ") + table.tableName);
+            ret._readers = _readers;
+            return ret;
+        }
+
+    protected:
+        std::shared_ptr<BOT_ORM_Impl::ReaderPool> _readers;
+
+        Snapshot (std::shared_ptr<BOT_ORM_Impl::ReaderPool> readers)
+            : _readers (std::move (readers))
+        {}
+
+        friend class ORMapper;
+    };
+
+    // Blob Stream
+    // - Read / Write a Blob in place (without Loading it all)
+    // - Size is Fixed (Reserve it by a 'BlobView' of nullptr)
+
+    class BlobStream
+    {
+    public:
+        size_t Size () const
+        {
+            return (size_t) sqlite3_blob_bytes (_blob.get ());
+        }
+
+        void Read (void *buffer, size_t size, size_t offset = 0) const
+        {
+            _Check (sqlite3_blob_read (_blob.get (), buffer,
+                (int) size, (int) offset));
+        }
+
+        void Write (const void *data, size_t size, size_t offset = 0)
+        {
+            _Check (sqlite3_blob_write (_blob.get (), data,
+                (int) size, (int) offset));
+        }
+
+        // Move to the Same Column of Row 'rowid'
+        void MoveTo (long long rowid)
+        {
+            _Check (sqlite3_blob_reopen (_blob.get (), rowid));
+        }
+
+    protected:
+        std::shared_ptr<BOT_ORM_Impl::SQLConnector> _connector;
+        std::unique_ptr<sqlite3_blob, decltype (&sqlite3_blob_close)> _blob;
+
+        BlobStream (std::shared_ptr<BOT_ORM_Impl::SQLConnector> connector,
+            sqlite3_blob *blob)
+            : _connector (std::move (connector)),
+            _blob (blob, sqlite3_blob_close)
+        {}
+
+        static void _Check (int rc)
+        {
+            if (rc != SQLITE_OK)
+                throw std::runtime_error (
+                    std::string ("SQL error: Can't access blob '") +
+                    sqlite3_errstr (rc) + "'");
+        }
+
+        friend class ORMapper;
+    };
+
+    // ORMapper
+
+    class ORMapper
+    {
+        template <typename C>
+        using HasInjected =
+            BOT_ORM_Impl::InjectionHelper::HasInjected<C>;
+
+    public:
+        ORMapper (const std::string &connectionString)
+            : _connector (
+                std::make_shared<BOT_ORM_Impl::SQLConnector> (
+                    connectionString)),
+            _extensions (std::make_shared<BOT_ORM_Impl::Extensions> ()),
+            _readers (
+                std::make_shared<BOT_ORM_Impl::ReaderPool> (
+                    _connector->FileName (), _extensions))
+        {
+            _connector->Execute ("PRAGMA foreign_keys = ON;");
+        }
+
+        // Report every Query of 'Queryable' to 'listener'
+        void OnQuery (
+            std::function<void (const QueryReport &)> listener)
+        {
+            _connector->SetQueryListener (std::move (listener));
+        }
+
+        // Check Query Plan of every Query of 'Queryable'
+        void AdviseQuery (bool enable = true, bool throwOnIssue = false)
+        {
+            _connector->SetQueryAdvisor (enable, throwOnIssue);
+        }
+
+        // Register 'fn' as a SQL Scalar Function
+        // - Return a Helper to Call it with Fields
+        template <typename Fn>
+        auto RegisterFunction (const std::string &name, Fn fn)
+        {
+            using Traits = BOT_ORM_Impl::FunctionTraits<Fn>;
+            return _RegisterFunction<typename Traits::Result> (
+                name, std::move (fn), typename Traits::Arguments {});
+        }
+
+        // Register a SQL Aggregate Function
+        // - 'state = step (state, args...)' for each Row,
+        //   starting from 'state = init'
+        // - Result is 'final (state)'
+        template <typename State, typename Step, typename Final>
+        auto RegisterAggregate (const std::string &name,
+            State init, Step step, Final final)
+        {
+            using Agg = BOT_ORM_Impl::FunctionHelper::
+                Aggregate<State, Step, Final>;
+            using Traits = BOT_ORM_Impl::FunctionTraits<Step>;
+            return _RegisterAggregate<typename BOT_ORM_Impl::
+                FunctionTraits<Final>::Result> (name,
+                    new Agg { std::move (init), std::move (step),
+                    std::move (final) },
+                typename Traits::Arguments {});
+        }
+
+        // Open the Blob of 'field' in Row 'rowid' for Incremental I/O
+        BlobStream OpenBlob (const Expression::Field<Blob> &field,
+            long long rowid, bool writable = false)
+        {
+            return BlobStream { _connector, _connector->OpenBlob (
+                *(field.tableName), field.fieldName, rowid, writable) };
+        }
+
+        BlobStream OpenBlob (const Expression::Field<BlobView> &field,
+            long long rowid, bool writable = false)
+        {
+            return BlobStream { _connector, _connector->OpenBlob (
+                *(field.tableName), field.fieldName, rowid, writable) };
+        }
+
+        // Expose 'entities' as a Read-only Virtual Table 'tableName'
+        // with the Fields of C
+        // - Query / Join it by 'Named (tableName, helper)'
+        // - Rows are Read in place, so 'entities' must Outlive Queries
+        //   (Expose again after Modifying it)
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Expose (const std::string &, const std::vector<C> &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Expose (const std::string &tableName,
+                const std::vector<C> &entities)
+        {
+            using Table = BOT_ORM_Impl::ExposedTable<C>;
+
+            auto table = static_cast<Table *> (
+                _extensions->FindModule (tableName, Table::Module ()));
+            if (table != nullptr)
+            {
+                table->Reset (entities);
+                return;
+            }
+
+            _extensions->AddModule (tableName, Table::Module (),
+                std::make_shared<Table> (entities), *_connector);
+        }
+
+        // Report every Committed Change of the Table of 'entity'
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            OnChange (const C &,
+                std::function<void (const RowChange &)>)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            OnChange (const C &entity,
+                std::function<void (const RowChange &)> listener)
+        {
+            _connector->AddChangeListener (
+                BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                std::move (listener));
+        }
+
+#ifdef SQLITE_ENABLE_SESSION
+        // Record Changes of the Table of 'entity' into a Changeset
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            RecordChanges (const C &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            RecordChanges (const C &entity)
+        {
+            _connector->RecordChanges (
+                BOT_ORM_Impl::InjectionHelper::TableName (entity));
+        }
+
+        // Take the Changeset Recorded since the Last Call
+        std::string ExportChangeset ()
+        {
+            return _connector->TakeChangeset ();
+        }
+
+        // Apply a Changeset from 'ExportChangeset'
+        void ApplyChangeset (const std::string &changeset)
+        {
+            _connector->ApplyChangeset (changeset);
+        }
+#endif  // SQLITE_ENABLE_SESSION
+
+        // Checkpoint the WAL File on a Background Thread
+        // - When a Commit leaves 'walFrames' Frames in the WAL File
+        //   or 'interval' Elapses after Commits
+        void CheckpointInBackground (bool enable = true,
+            std::chrono::milliseconds interval = std::chrono::seconds (1),
+            int walFrames = 1000)
+        {
+            _checkpointer.reset ();
+            if (enable)
+                _checkpointer =
+                    std::make_shared<BOT_ORM_Impl::Checkpointer> (
+                        _connector, interval, walFrames);
+        }
+
+        // Counters of Compressed Fields on Insert / Update
+        CompressionStats CompressionMetrics () const
+        {
+            return _connector->CompressionMetrics ();
+        }
+
+        CheckpointStats CheckpointMetrics () const
+        {
+            if (!_checkpointer)
+                return CheckpointStats {};
+            return _checkpointer->Stats ();
+        }
+
+#ifdef SQLITE_ENABLE_SNAPSHOT
+        // Pin the Committed State of a WAL Mode Database File
+        BOT_ORM::Snapshot Snapshot ()
+        {
+            return BOT_ORM::Snapshot (
+                std::make_shared<BOT_ORM_Impl::ReaderPool> (
+                    _connector->FileName (), _extensions, true));
+        }
+#endif  // SQLITE_ENABLE_SNAPSHOT
+
+        // Copy the Database to 'destPath' without Blocking Writers
+        // - Copy 'pagesPerStep' Pages a Step, and Sleep between Steps
+        void Backup (const std::string &destPath,
+            int pagesPerStep = 100,
+            std::chrono::milliseconds sleepBetweenSteps =
+            std::chrono::milliseconds (10),
+            std::function<void (int remaining, int total)> progress =
+            nullptr)
+        {
+            _connector->BackupTo (destPath, pagesPerStep,
+                sleepBetweenSteps, progress);
+        }
+
+        // Replace the Database by the Content of 'srcPath'
+        // (Load a File into an In-memory Database)
+        void Restore (const std::string &srcPath)
+        {
+            _connector->RestoreFrom (srcPath);
+            _ClearSchemaCaches ();
+        }
+
+        // Serve an In-memory Database, and Persist it to 'fileName'
+        // every 'interval' (Loading 'fileName' first)
+        void WriteBehind (const std::string &fileName,
+            std::chrono::milliseconds interval = std::chrono::seconds (1))
+        {
+            if (!_connector->FileName ().empty ())
+                throw std::runtime_error (NOT_IN_MEMORY);
+
+            _flusher.reset ();
+            _flusher = std::make_shared<BOT_ORM_Impl::Flusher> (
+                _connector, fileName, interval);
+            _ClearSchemaCaches ();
+        }
+
+        // Persist the In-memory Database Now
+        // - Return false if in a Transaction or NOT Write-behind
+        bool Flush ()
+        {
+            return _flusher && _flusher->Flush ();
+        }
+
+        template <typename Fn>
+        void Transaction (Fn fn)
+        {
+            try
+            {
+                _connector->Execute ("begin transaction;");
+                fn ();
+                _connector->Execute ("commit transaction;");
+            }
+            catch (...)
+            {
+                // NOT in Transaction if Committed (but Change Listeners
+                // Threw) or Rolled back by SQLite
+                if (_connector->InTransaction ())
+                    _connector->Execute ("rollback transaction;");
+                throw;
+            }
+        }
+
+        template <typename C, typename... Args>
+        std::enable_if_t<!HasInjected<C>::value>
+            CreateTbl (const C &, const Args & ...)
+        {}
+        template <typename C, typename... Args>
+        std::enable_if_t<HasInjected<C>::value>
+            CreateTbl (const C &entity,
+                const Args & ... constraints)
+        {
+            const auto &fieldNames =
+                BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+            std::unordered_map<std::string, std::string> fieldFixes;
+
+            auto addTypeStr = [&fieldNames, &fieldFixes] (
+                const auto &arg, size_t index)
+            {
+                // Why addTypeStr?
+                // Walkaround the 'undefined reference' in gcc/clang
+                constexpr const char *typeStr = BOT_ORM_Impl::TypeString<
+                    std::remove_cv_t<std::remove_reference_t<decltype(arg)>>
+                >::typeStr;
+                fieldFixes.emplace (fieldNames[index].ToString (), typeStr);
+            };
+            (void) addTypeStr;
+
+            BOT_ORM_Impl::InjectionHelper::Visit (
+                entity, [&addTypeStr] (const auto & ... args)
+            {
+                size_t index = 0;
+                (void) BOT_ORM_Impl::Expander
+                {
+                    0, (addTypeStr (args, index++), 0)...
+                };
+            });
+
+            // First Field is the Primary Key unless Specified
+            auto anyPrimaryKey = false;
+            (void) BOT_ORM_Impl::Expander
+            {
+                0, (anyPrimaryKey |= constraints.primaryKey, 0)...
+            };
+            if (!anyPrimaryKey)
+                fieldFixes[fieldNames[0].ToString ()] += " primary key";
+
+            // Full-text / Spatial Indexes are Synced by Rowid
+            auto anyWithoutRowid = false, anySyncedIndex = false;
+            (void) BOT_ORM_Impl::Expander
+            {
+                0, (anyWithoutRowid |=
+                    constraints.option == "without rowid", 0)...
+            };
+            (void) BOT_ORM_Impl::Expander
+            {
+                0, (anySyncedIndex |= !constraints.fullText.empty () ||
+                    !constraints.spatial.empty (), 0)...
+            };
+            if (anyWithoutRowid && anySyncedIndex)
+                throw std::runtime_error (NO_ROWID_INDEX);
+
+            const auto &tableName =
+                BOT_ORM_Impl::InjectionHelper::TableName (entity);
+
+            std::string tableFixes, indexFixes, tableOptions;
+            _GetConstraints (tableName, tableFixes, indexFixes,
+                tableOptions, fieldFixes, constraints...);
+
+            std::string strFmt;
+            for (const auto &fieldName : fieldNames)
+            {
+                auto field = fieldName.ToString ();
+                strFmt += field + fieldFixes[field] + ",";
+            }
+            strFmt += std::move (tableFixes);
+            strFmt.pop_back ();
+
+            if (!tableOptions.empty ())
+            {
+                tableOptions.pop_back ();
+                tableOptions = " " + tableOptions;
+            }
+
+            _primaryKeys.erase (tableName);
+            _compressedFields.erase (tableName);
+            _connector->ClearStatements ();
+            _connector->Execute (
+                "create table " + tableName +
+                "(" + strFmt + ")" + tableOptions + ";" + indexFixes);
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            DropTbl (const C &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            DropTbl (const C &entity)
+        {
+            const auto &tableName =
+                BOT_ORM_Impl::InjectionHelper::TableName (entity);
+
+            // Full-text / Spatial Indexes are NOT Dropped with the Table
+            std::string dropIndexes;
+            _connector->ExecuteCallback (
+                "select name from sqlite_master where type='table'"
+                " and sql like 'create virtual table%'"
+                " and (name like '" + BOT_ORM_Impl::FullTextName (
+                    tableName, "%") + "' or name like '" +
+                BOT_ORM_Impl::SpatialName (tableName, "%") + "');",
+                [&dropIndexes] (int argc, char **argv)
+            {
+                if (argc != 1)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+                dropIndexes += "drop table " +
+                    std::string (argv[0]) + ";";
+            });
+
+            _primaryKeys.erase (tableName);
+            _compressedFields.erase (tableName);
+            _connector->ClearStatements ();
+            _connector->Execute (
+                "drop table " + tableName + ";" + dropIndexes);
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            CreateIndex (const C &, const Constraint &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            CreateIndex (const C &entity, const Constraint &index)
+        {
+            _connector->Execute (_GetIndex (
+                BOT_ORM_Impl::InjectionHelper::TableName (entity), index));
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            DropIndex (const C &, const Constraint &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            DropIndex (const C &entity, const Constraint &index)
+        {
+            if (index.index.empty ())
+                throw std::runtime_error (NOT_INDEX);
+            if (!index.fullText.empty ())
+            {
+                _connector->ClearStatements ();
+                _connector->Execute (_DropSyncedIndex (
+                    BOT_ORM_Impl::FullTextName (
+                        BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                        index.fullText)));
+                return;
+            }
+            if (!index.spatial.empty ())
+            {
+                _connector->ClearStatements ();
+                _connector->Execute (_DropSyncedIndex (
+                    BOT_ORM_Impl::SpatialName (
+                        BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                        index.spatial)));
+                return;
+            }
+            _connector->Execute (
+                "drop index " + _GetIndexName (
+                    BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                    index) + ";");
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Register ()
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Register ()
+        {
+            const C entity {};
+            const auto &keys = _GetPrimaryKey (entity);
+            const auto fieldCount =
+                BOT_ORM_Impl::InjectionHelper::FieldNames (entity).size ();
+
+            if (fieldCount <= _MAX_MASK_FIELDS)
+            {
+                auto allFields = fieldCount == _MAX_MASK_FIELDS
+                    ? ~std::uint64_t (0)
+                    : (std::uint64_t (1) << fieldCount) - 1;
+                auto keyFields = std::uint64_t (0);
+                for (auto key : keys)
+                    keyFields |= std::uint64_t (1) << key;
+
+                _GetInsertStatement (entity, allFields);
+                _GetInsertStatement (entity, allFields & ~keyFields);
+            }
+            if (fieldCount > keys.size ())
+                _GetUpdateStatement (entity, keys, 0);
+            _GetDeleteStatement (entity, keys);
+            _GetSelectStatement (entity, keys, 0);
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value, Nullable<C>>
+            Find (const C &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value, Nullable<C>>
+            Find (const C &entity)
+        {
+            const auto &keys = _GetPrimaryKey (entity);
+            auto stmt = _GetSelectStatement (entity, keys, 0);
+            _BindKeys (stmt, entity, keys, 1);
+
+            Nullable<C> ret;
+            _connector->StepStatement (stmt, [stmt, &entity, &ret] ()
+            {
+                auto copy = entity;
+                BOT_ORM_Impl::InjectionHelper::Visit (
+                    copy, [stmt] (auto & ... args)
+                {
+                    int index = 0;
+                    (void) BOT_ORM_Impl::Expander
+                    {
+                        0, (BOT_ORM_Impl::BindingHelper::
+                            Column (stmt, index++, args), 0)...
+                    };
+                });
+                ret = copy;
+            });
+            return ret;
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value, long long>
+            Insert (const C &, bool = true)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value, long long>
+            Insert (const C &entity, bool withId = true)
+        {
+            return _Insert (entity,
+                withId ? nullptr : &_GetPrimaryKey (entity));
+        }
+
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<!HasInjected<C>::value, std::vector<long long>>
+            InsertRange (const In &, bool = true)
+        {}
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<HasInjected<C>::value, std::vector<long long>>
+            InsertRange (const In &entities, bool withId = true)
+        {
+            std::vector<long long> ret;
+            _Atomically ([this, &entities, withId, &ret]
+            {
+                for (const auto &entity : entities)
+                    ret.push_back (_Insert (entity,
+                        withId ? nullptr : &_GetPrimaryKey (entity)));
+            });
+            return ret;
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Update (const C &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Update (const C &entity)
+        {
+            _Update (entity, _GetPrimaryKey (entity), 0);
+        }
+
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<!HasInjected<C>::value>
+            UpdateRange (const In &)
+        {}
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<HasInjected<C>::value>
+            UpdateRange (const In &entities)
+        {
+            _Atomically ([this, &entities]
+            {
+                for (const auto &entity : entities)
+                    _Update (entity, _GetPrimaryKey (entity), 0);
+            });
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Upsert (const C &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Upsert (const C &entity)
+        {
+            _Atomically ([this, &entity]
+            {
+                _Upsert (entity, _GetPrimaryKey (entity), 0);
+            });
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Upsert (const C &, const Constraint &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Upsert (const C &entity, const Constraint &conflictTarget)
+        {
+            auto target = _GetConflictTarget (entity, conflictTarget);
+            _Atomically ([this, &entity, &target]
+            {
+                _Upsert (entity, target.first, target.second);
+            });
+        }
+
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<!HasInjected<C>::value>
+            UpsertRange (const In &)
+        {}
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<HasInjected<C>::value>
+            UpsertRange (const In &entities)
+        {
+            _Atomically ([this, &entities]
+            {
+                for (const auto &entity : entities)
+                    _Upsert (entity, _GetPrimaryKey (entity), 0);
+            });
+        }
+
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<!HasInjected<C>::value>
+            UpsertRange (const In &, const Constraint &)
+        {}
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<HasInjected<C>::value>
+            UpsertRange (const In &entities,
+                const Constraint &conflictTarget)
+        {
+            _Atomically ([this, &entities, &conflictTarget]
+            {
+                std::pair<std::vector<size_t>, std::uint64_t> target;
+                for (const auto &entity : entities)
+                {
+                    if (target.first.empty ())
+                        target = _GetConflictTarget (entity, conflictTarget);
+                    _Upsert (entity, target.first, target.second);
+                }
+            });
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Update (const C &,
+                const Expression::SetExpr &,
+                const Expression::Expr &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Update (const C &entity,
+                const Expression::SetExpr &setExpr,
+                const Expression::Expr &whereExpr)
+        {
+            _connector->Execute (
+                "update " +
+                BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                " set " + setExpr.ToString () +
+                " where " +
+                whereExpr.ToString () + ";");
+        }
+
+        template <typename C>
+        std::enable_if_t<!HasInjected<C>::value>
+            Delete (const C &)
+        {}
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Delete (const C &entity)
+        {
+            const auto &keys = _GetPrimaryKey (entity);
+            auto stmt = _GetDeleteStatement (entity, keys);
+            _BindKeys (stmt, entity, keys, 1);
+            _connector->StepStatement (stmt);
+        }
+
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<!HasInjected<C>::value>
+            DeleteRange (const In &)
+        {}
+        template <typename In, typename C = typename In::value_type>
+        std::enable_if_t<HasInjected<C>::value>
+            DeleteRange (const In &entities)
+        {
+            _Atomically ([this, &entities]
+            {
+                auto remaining = size_t (std::distance (
+                    entities.begin (), entities.end ()));
+                sqlite3_stmt *stmt = nullptr;
+                size_t chunkSize = 0, param = 0;
+
+                for (const auto &entity : entities)
+                {
+                    const auto &keys = _GetPrimaryKey (entity);
+
+                    // Composite Keys are Deleted One by One
+                    if (keys.size () != 1)
+                    {
+                        auto stmtKey = _GetDeleteStatement (entity, keys);
+                        _BindKeys (stmtKey, entity, keys, 1);
+                        _connector->StepStatement (stmtKey);
+                        continue;
+                    }
+
+                    // Clear Keys Left by a Failed Chunk
+                    if (param == 0)
+                    {
+                        chunkSize = _GetChunkSize (remaining);
+                        stmt = _GetDeleteInStatement (
+                            entity, keys.front (), chunkSize);
+                        sqlite3_clear_bindings (stmt);
+                    }
+                    _BindKeys (stmt, entity, keys, int (++param));
+                    remaining--;
+
+                    // Unbound Parameters are NULL (Matching Nothing)
+                    if (param == chunkSize || remaining == 0)
+                    {
+                        _connector->StepStatement (stmt);
+                        param = 0;
+                    }
+                }
+            });
         }
 
-        // Join
         template <typename C>
-        inline auto Join (const C &,
-            const Expression::Expr &,
-            std::enable_if_t<
-            !HasInjected<C>::value>
-            * = nullptr) const
+        std::enable_if_t<!HasInjected<C>::value>
+            Delete (const C &,
+                const Expression::Expr &)
         {}
         template <typename C>
-        inline auto Join (const C &queryHelper2,
-            const Expression::Expr &onExpr,
-            std::enable_if_t<
-            HasInjected<C>::value>
-            * = nullptr) const
+        std::enable_if_t<HasInjected<C>::value>
+            Delete (const C &entity,
+                const Expression::Expr &whereExpr)
         {
-            return _NewJoinQuery (queryHelper2, onExpr, " join ");
+            _connector->Execute (
+                "delete from " +
+                BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                " where " +
+                whereExpr.ToString () + ";");
         }
 
-        // Left Join
         template <typename C>
-        inline auto LeftJoin (const C &,
-            const Expression::Expr &,
-            std::enable_if_t<
-            !HasInjected<C>::value>
-            * = nullptr) const
+        std::enable_if_t<!HasInjected<C>::value, Queryable<C>>
+            Query (C)
         {}
         template <typename C>
-        inline auto LeftJoin (const C &queryHelper2,
-            const Expression::Expr &onExpr,
-            std::enable_if_t<
-            HasInjected<C>::value>
-            * = nullptr) const
+        std::enable_if_t<HasInjected<C>::value, Queryable<C>>
+            Query (C queryHelper)
+        {
+            auto ret = Queryable<C> (
+                _connector,
+                std::move (queryHelper),
+                std::string (" from ") +
+                BOT_ORM_Impl::InjectionHelper::TableName (queryHelper));
+            ret._readers = _readers;
+            return ret;
+        }
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value, Queryable<C>>
+            Query (const NamedTable<C> &table)
         {
-            return _NewJoinQuery (queryHelper2, onExpr, " left join ");
+            auto ret = Queryable<C> (
+                _connector, table.helper,
+                std::string (" from ") + table.tableName);
+            ret._readers = _readers;
+            return ret;
         }
 
-        // Compound Select
-        inline Queryable Union (const Queryable &queryable) const
+    protected:
+        std::shared_ptr<BOT_ORM_Impl::SQLConnector> _connector;
+
+        // Registered Functions and Modules (for Pooled Connections)
+        std::shared_ptr<BOT_ORM_Impl::Extensions> _extensions;
+
+        // Connections of Parallel Scans
+        std::shared_ptr<BOT_ORM_Impl::ReaderPool> _readers;
+
+        // Background Checkpoints (Stopped before Disconnecting)
+        std::shared_ptr<BOT_ORM_Impl::Checkpointer> _checkpointer;
+
+        // Write-behind (Flushed before Disconnecting)
+        std::shared_ptr<BOT_ORM_Impl::Flusher> _flusher;
+
+        template <typename R, typename Fn, typename... Args>
+        auto _RegisterFunction (const std::string &name, Fn fn,
+            std::tuple<Args...>)
         {
-            return _NewCompoundQuery (queryable, " union ");
+            _extensions->AddFunction (name, sizeof... (Args),
+                std::shared_ptr<void> (new Fn (std::move (fn)),
+                    BOT_ORM_Impl::FunctionHelper::Destroy<Fn>),
+                BOT_ORM_Impl::FunctionHelper::Scalar<Fn>,
+                nullptr, nullptr, *_connector);
+            return Expression::UserFunction<R, typename
+                BOT_ORM_Impl::FieldType<Args>::type...> { name };
         }
-        inline Queryable UnionAll (Queryable queryable) const
+
+        template <typename R, typename Agg,
+            typename State, typename... Args>
+        auto _RegisterAggregate (const std::string &name, Agg *agg,
+            std::tuple<State, Args...>)
         {
-            return _NewCompoundQuery (queryable, " union all ");
+            _extensions->AddFunction (name, sizeof... (Args),
+                std::shared_ptr<void> (agg,
+                    BOT_ORM_Impl::FunctionHelper::Destroy<Agg>),
+                nullptr,
+                BOT_ORM_Impl::FunctionHelper::Step<Agg>,
+                BOT_ORM_Impl::FunctionHelper::Final<Agg>, *_connector);
+            return Expression::UserAggregate<R, typename
+                BOT_ORM_Impl::FieldType<Args>::type...> { name };
         }
-        inline Queryable Intersect (Queryable queryable) const
+
+        // Table Name -> Indices of Primary Key Fields
+        std::unordered_map<std::string, std::vector<size_t>> _primaryKeys;
+
+        // Table Name -> Whether each Field is Compressed
+        std::unordered_map<std::string, std::vector<bool>> _compressedFields;
+
+        // Forget the Schema after the Database is Replaced
+        // (Statements are Cleared by 'RestoreFrom')
+        void _ClearSchemaCaches ()
         {
-            return _NewCompoundQuery (queryable, " intersect ");
+            _primaryKeys.clear ();
+            _compressedFields.clear ();
         }
-        inline Queryable Except (Queryable queryable) const
+
+        // Max Field Count of Insert Statements Cached by Mask
+        constexpr static size_t _MAX_MASK_FIELDS = 64;
+
+        static void _GetConstraints (
+            const std::string &,
+            std::string &, std::string &, std::string &,
+            std::unordered_map<std::string, std::string> &)
+        {}
+
+        template <typename... Args>
+        static void _GetConstraints (
+            const std::string &tableName,
+            std::string &tableFixes,
+            std::string &indexFixes,
+            std::string &tableOptions,
+            std::unordered_map<std::string, std::string> &fieldFixes,
+            const Constraint &constraint,
+            const Args & ... args)
         {
-            return _NewCompoundQuery (queryable, " excpet ");
+            if (!constraint.index.empty ())
+                indexFixes += _GetIndex (tableName, constraint);
+            else if (constraint.compressed)  // Type 'compressed text'
+                fieldFixes[constraint.field].insert (0, " compressed");
+            else if (!constraint.option.empty ())
+                tableOptions += constraint.option + ",";
+            else if (!constraint.field.empty ())
+                fieldFixes[constraint.field] += constraint.constraint;
+            else
+                tableFixes += constraint.constraint + ",";
+            _GetConstraints (tableName, tableFixes, indexFixes,
+                tableOptions, fieldFixes, args...);
         }
 
-        // Get Result
-        template <typename T>
-        Nullable<T> Aggregate (const Expression::Aggregate<T> &agg) const
+        // Look up the Primary Key declared in the Table Schema
+        // (First Field if Table has no Declared Key)
+        template <typename C>
+        const std::vector<size_t> &_GetPrimaryKey (const C &entity)
         {
-            Nullable<T> ret;
-            _connector->ExecuteCallback (_sqlSelect + agg.fieldName +
-                _GetFromSql () + _GetLimit () + ";",
+            static const std::vector<size_t> firstField { 0 };
+
+            const auto &tableName =
+                BOT_ORM_Impl::InjectionHelper::TableName (entity);
+            auto cached = _primaryKeys.find (tableName);
+            if (cached != _primaryKeys.end ())
+                return cached->second;
+
+            const auto &fieldNames =
+                BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+            std::vector<std::pair<int, size_t>> keys;
+            auto anyColumn = false;
+
+            // cid, name, type, notnull, dflt_value, pk
+            _connector->ExecuteCallback (
+                "pragma table_info(" + tableName + ");",
                 [&] (int argc, char **argv)
             {
-                if (argc != 1)
+                if (argc != 6)
                     throw std::runtime_error (BAD_COLUMN_COUNT);
-
-                BOT_ORM_Impl::DeserializationHelper::
-                    Deserialize (ret, argv[0]);
+                anyColumn = true;
+
+                auto keyIndex = std::stoi (argv[5]);
+                auto field = std::find (fieldNames.begin (),
+                    fieldNames.end (), argv[1]);
+                if (keyIndex != 0 && field != fieldNames.end ())
+                    keys.emplace_back (keyIndex,
+                        field - fieldNames.begin ());
             });
-            return ret;
-        }
 
-        std::vector<QueryResult> ToVector () const
-        {
-            std::vector<QueryResult> ret;
-            _Select (_queryHelper, ret);
-            return ret;
-        }
-        std::list<QueryResult> ToList () const
-        {
-            std::list<QueryResult> ret;
-            _Select (_queryHelper, ret);
-            return ret;
+            // Not Created yet
+            if (!anyColumn)
+                return firstField;
+
+            std::sort (keys.begin (), keys.end ());
+            std::vector<size_t> ret;
+            for (const auto &key : keys)
+                ret.push_back (key.second);
+            if (ret.empty ())
+                ret = firstField;
+            return _primaryKeys.emplace (tableName,
+                std::move (ret)).first->second;
         }
 
-    protected:
-        // Return FROM part for Query
-        inline std::string _GetFromSql () const
+        // Look up the Fields declared as 'compressed' in the Table Schema
+        template <typename C>
+        const std::vector<bool> &_GetCompressedFields (const C &entity)
         {
-            return _sqlFrom + _sqlWhere + _sqlGroupBy + _sqlHaving;
-        }
+            static const std::vector<bool> none;
 
-        // Return ORDER BY & LIMIT part for Query
-        inline std::string _GetLimit () const
-        {
-            return _sqlOrderBy + _sqlLimit + _sqlOffset;
-        }
+            const auto &tableName =
+                BOT_ORM_Impl::InjectionHelper::TableName (entity);
+            auto cached = _compressedFields.find (tableName);
+            if (cached != _compressedFields.end ())
+                return cached->second;
 
-        // Return a new Queryable Object
-        template <typename... Args>
-        inline Queryable<std::tuple<Args...>> _NewQuery (
-            std::string sqlTarget,
-            std::string sqlFrom,
-            std::tuple<Args...> &&newQueryHelper) const
-        {
-            return Queryable<std::tuple<Args...>> (
-                _connector, newQueryHelper,
-                std::move (sqlFrom),
-                _sqlSelect, std::move (sqlTarget),
-                _sqlWhere, _sqlGroupBy, _sqlHaving,
-                _sqlOrderBy, _sqlLimit, _sqlOffset);
-        }
+            const auto &fieldNames =
+                BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+            std::vector<bool> ret (fieldNames.size (), false);
+            auto anyColumn = false;
 
-        // Return a new Join Queryable Object
-        template <typename C>
-        inline auto _NewJoinQuery (const C &queryHelper2,
-            const Expression::Expr &onExpr,
-            std::string joinStr) const
-        {
-            return _NewQuery (
-                _sqlTarget,
-                _sqlFrom + std::move (joinStr) +
-                BOT_ORM_Impl::InjectionHelper::TableName (queryHelper2) +
-                " on " + onExpr.ToString (),
-                BOT_ORM_Impl::QueryableHelper::JoinToTuple (
-                    _queryHelper, queryHelper2));
+            // cid, name, type, notnull, dflt_value, pk
+            _connector->ExecuteCallback (
+                "pragma table_info(" + tableName + ");",
+                [&] (int argc, char **argv)
+            {
+                if (argc != 6)
+                    throw std::runtime_error (BAD_COLUMN_COUNT);
+                anyColumn = true;
+
+                auto field = std::find (fieldNames.begin (),
+                    fieldNames.end (), argv[1]);
+                if (field != fieldNames.end () && argv[2] &&
+                    std::strstr (argv[2], "compressed"))
+                    ret[field - fieldNames.begin ()] = true;
+            });
+
+            // Not Created yet
+            if (!anyColumn)
+                return none;
+
+            return _compressedFields.emplace (tableName,
+                std::move (ret)).first->second;
         }
 
-        // Return a new Compound Queryable Object
-        Queryable _NewCompoundQuery (const Queryable &queryable,
-            std::string compoundStr) const
+        static inline bool _IsKey (
+            const std::vector<size_t> &keys, size_t index)
         {
-            auto ret = *this;
-            ret._sqlFrom = ret._GetFromSql () +
-                std::move (compoundStr) +
-                queryable._sqlSelect + queryable._sqlTarget +
-                queryable._GetFromSql ();
-            ret._sqlWhere.clear ();
-            ret._sqlGroupBy.clear ();
-            ret._sqlHaving.clear ();
-            return ret;
+            return std::find (keys.begin (), keys.end (), index)
+                != keys.end ();
         }
 
-        // Select for Normal Objects
-        template <typename C, typename Out>
-        inline void _Select (const C &, Out &out) const
+        // Skip 'skippedKeys' if it's NOT nullptr
+        // Return the Rowid of the Inserted Entry
+        template <typename C>
+        long long _Insert (const C &entity,
+            const std::vector<size_t> *skippedKeys)
         {
-            auto copy = _queryHelper;
-            _connector->ExecuteCallback (_sqlSelect + _sqlTarget +
-                _GetFromSql () + _GetLimit () + ";",
-                [&] (int argc, char **argv)
+            // Too Many Fields to be Masked
+            if (BOT_ORM_Impl::InjectionHelper::FieldNames (entity).size ()
+                > _MAX_MASK_FIELDS)
             {
-                BOT_ORM_Impl::InjectionHelper::Visit (
-                    copy, [argc] (auto & ... args)
+                BOT_ORM_Impl::SQLWriter os;
+                _GetInsert (os, entity, skippedKeys);
+                _connector->Execute (os.Str ());
+                return _connector->LastInsertRowid ();
+            }
+
+            // Null Fields are Skipped to Apply the Default Values
+            auto mask = std::uint64_t (0);
+            BOT_ORM_Impl::InjectionHelper::Visit (
+                entity, [&mask, skippedKeys] (const auto & ... args)
+            {
+                auto maskField = [&mask, skippedKeys] (
+                    const auto &val, size_t index)
                 {
-                    if (sizeof... (args) != argc)
-                        throw std::runtime_error (BAD_COLUMN_COUNT);
-                });
+                    if (!_IsNull (val) &&
+                        !(skippedKeys && _IsKey (*skippedKeys, index)))
+                        mask |= std::uint64_t (1) << index;
+                };
 
-                BOT_ORM_Impl::InjectionHelper::Visit (
-                    copy, [argv] (auto & ... args)
+                size_t index = 0;
+                (void) BOT_ORM_Impl::Expander
                 {
-                    size_t index = 0;
-                    (void) BOT_ORM_Impl::Expander
-                    {
-                        0, (BOT_ORM_Impl::DeserializationHelper::
-                            Deserialize (args, argv[index++]), 0)...
-                    };
-                });
-                out.push_back (copy);
+                    0, (maskField (args, index++), 0)...
+                };
+                (void) maskField;
+            });
+
+            auto stmt = _GetInsertStatement (entity, mask);
+            _BindFields (stmt, entity, [mask] (size_t index)
+            {
+                return (mask >> index & 1) != 0;
             });
+            _connector->StepStatement (stmt);
+            return _connector->LastInsertRowid ();
         }
 
-        // Select for Tuples
-        template <typename Out, typename... Args>
-        inline void _Select (const std::tuple<Args...> &, Out &out) const
+        // Return false if All Fields are Keys
+        template <typename C>
+        bool _Update (const C &entity,
+            const std::vector<size_t> &keys, std::uint64_t keyMask)
         {
-            auto copy = _queryHelper;
-            _connector->ExecuteCallback (_sqlSelect + _sqlTarget +
-                _GetFromSql () + _GetLimit () + ";",
-                [&] (int argc, char **argv)
-            {
-                if (sizeof... (Args) != argc)
-                    throw std::runtime_error (BAD_COLUMN_COUNT);
+            const auto fieldCount =
+                BOT_ORM_Impl::InjectionHelper::FieldNames (entity).size ();
+            const auto fixed = _GetFixedFields (entity, keys, keyMask);
+            if (fieldCount <= fixed.size ())
+                return false;
 
-                size_t index = 0;
-                BOT_ORM_Impl::QueryableHelper::TupleVisit (
-                    copy, [argv, &index] (auto &val)
-                {
-                    BOT_ORM_Impl::DeserializationHelper::
-                        Deserialize (val, argv[index++]);
-                });
-                out.push_back (copy);
+            auto stmt = _GetUpdateStatement (entity, keys, keyMask);
+            _BindFields (stmt, entity, [&fixed] (size_t index)
+            {
+                return !_IsKey (fixed, index);
             });
+            _BindKeys (stmt, entity, keys,
+                int (fieldCount - fixed.size ()) + 1);
+            _connector->StepStatement (stmt);
+            return true;
         }
-    };
 
-    // ORMapper
-
-    class ORMapper
-    {
+        // Fields NOT Set by Update: 'keys', and the Primary Key
+        // if 'keys' are other Unique Fields (to Keep References to the Entry)
         template <typename C>
-        using HasInjected =
-            BOT_ORM_Impl::InjectionHelper::HasInjected<C>;
-
-    public:
-        ORMapper (const std::string &connectionString)
-            : _connector (
-                std::make_shared<BOT_ORM_Impl::SQLConnector> (
-                    connectionString))
+        std::vector<size_t> _GetFixedFields (const C &entity,
+            const std::vector<size_t> &keys, std::uint64_t keyMask)
         {
-            _connector->Execute ("PRAGMA foreign_keys = ON;");
+            auto fixed = keys;
+            if (keyMask != 0)
+                for (auto key : _GetPrimaryKey (entity))
+                    if (!_IsKey (fixed, key))
+                        fixed.push_back (key);
+            return fixed;
         }
 
-        template <typename Fn>
-        void Transaction (Fn fn)
+        // Update the Entry with the Same 'keys' if Exists,
+        // otherwise Insert 'entity'
+        template <typename C>
+        void _Upsert (const C &entity,
+            const std::vector<size_t> &keys, std::uint64_t keyMask)
         {
-            try
+            if (_Update (entity, keys, keyMask))
             {
-                _connector->Execute ("begin transaction;");
-                fn ();
-                _connector->Execute ("commit transaction;");
+                if (_connector->Changes () != 0)
+                    return;
             }
-            catch (...)
+            else  // Nothing to Update if All Fields are Keys
             {
-                _connector->Execute ("rollback transaction;");
-                throw;
+                auto stmt = _GetSelectStatement (entity, keys, keyMask);
+                _BindKeys (stmt, entity, keys, 1);
+
+                auto exists = false;
+                _connector->StepStatement (stmt, [&exists] ()
+                {
+                    exists = true;
+                });
+                if (exists)
+                    return;
             }
+            _Insert (entity, nullptr);
         }
 
-        template <typename C, typename... Args>
-        std::enable_if_t<!HasInjected<C>::value>
-            CreateTbl (const C &, const Args & ...)
-        {}
-        template <typename C, typename... Args>
-        std::enable_if_t<HasInjected<C>::value>
-            CreateTbl (const C &entity,
-                const Args & ... constraints)
-        {
-            const auto &fieldNames =
-                BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
-            std::unordered_map<std::string, std::string> fieldFixes;
-
-            auto addTypeStr = [&fieldNames, &fieldFixes] (
-                const auto &arg, size_t index)
-            {
-                // Why addTypeStr?
-                // Walkaround the 'undefined reference' in gcc/clang
-                constexpr const char *typeStr = BOT_ORM_Impl::TypeString<
-                    std::remove_cv_t<std::remove_reference_t<decltype(arg)>>
-                >::typeStr;
-                fieldFixes.emplace (fieldNames[index], typeStr);
-            };
-            (void) addTypeStr;
-
-            BOT_ORM_Impl::InjectionHelper::Visit (
-                entity, [&addTypeStr] (const auto & ... args)
+        // Fields of a Unique / Primary Key Constraint
+        template <typename C>
+        static std::pair<std::vector<size_t>, std::uint64_t>
+            _GetConflictTarget (const C &entity,
+                const Constraint &conflictTarget)
+        {
+            if (conflictTarget.unique.empty ())
+                throw std::runtime_error (NOT_UNIQUE);
+
+            const auto &fieldNames =
+                BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+            std::vector<size_t> keys;
+            auto keyMask = std::uint64_t (0);
+
+            std::istringstream columns { conflictTarget.unique };
+            std::string column;
+            while (std::getline (columns, column, ','))
             {
-                size_t index = 0;
-                (void) BOT_ORM_Impl::Expander
-                {
-                    0, (addTypeStr (args, index++), 0)...
-                };
-            });
-            fieldFixes[fieldNames[0]] += " primary key";
+                auto field = std::find (fieldNames.begin (),
+                    fieldNames.end (), column.c_str ());
+                if (field == fieldNames.end ())
+                    throw std::runtime_error (NO_FIELD);
+
+                auto index = size_t (field - fieldNames.begin ());
+                if (index >= _MAX_MASK_FIELDS)
+                    throw std::runtime_error (NOT_UNIQUE);
+                keys.push_back (index);
+                keyMask |= std::uint64_t (1) << index;
+            }
+            return std::make_pair (std::move (keys), keyMask);
+        }
 
-            std::string tableFixes;
-            _GetConstraints (tableFixes, fieldFixes, constraints...);
+        // Run 'fn' in a Transaction unless One is Pending
+        template <typename Fn>
+        void _Atomically (Fn fn)
+        {
+            if (_connector->InTransaction ())
+                fn ();
+            else
+                Transaction (fn);
+        }
 
-            std::string strFmt;
-            for (const auto &field : fieldNames)
-                strFmt += field + fieldFixes[field] + ",";
-            strFmt += std::move (tableFixes);
-            strFmt.pop_back ();
+        template <typename T>
+        static inline bool _IsNull (const T &)
+        {
+            return false;
+        }
 
-            _connector->Execute (
-                "create table " +
-                BOT_ORM_Impl::InjectionHelper::TableName (entity) +
-                "(" + strFmt + ");");
+        template <typename T>
+        static inline bool _IsNull (const Nullable<T> &value)
+        {
+            return value == nullptr;
         }
 
+        // Cached Statements
+        // - Parameters are Fields in Order, followed by Keys in Order
+
         template <typename C>
-        std::enable_if_t<!HasInjected<C>::value>
-            DropTbl (const C &)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value>
-            DropTbl (const C &entity)
+        sqlite3_stmt *_GetInsertStatement (const C &entity,
+            std::uint64_t mask)
         {
-            _connector->Execute (
-                "drop table " +
-                BOT_ORM_Impl::InjectionHelper::TableName (entity) +
-                ";");
+            return _connector->Prepare ({
+                &BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                BOT_ORM_Impl::StatementKind::Insert, mask
+            }, [this, &entity, mask] ()
+            {
+                const auto &fieldNames =
+                    BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+                std::string fields, values;
+                for (size_t index = 0; index < fieldNames.size (); index++)
+                    if (mask >> index & 1)
+                    {
+                        fields += fieldNames[index].ToString () + ",";
+                        values += "?,";
+                    }
+
+                // Fix for No Field for Insert...
+                if (fields.empty ())
+                {
+                    fields = fieldNames[
+                        _GetPrimaryKey (entity).front ()].ToString () + ",";
+                    values = "null,";
+                }
+                fields.pop_back ();
+                values.pop_back ();
+
+                return "insert into " +
+                    BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                    "(" + fields + ") values (" + values + ");";
+            });
         }
 
         template <typename C>
-        std::enable_if_t<!HasInjected<C>::value>
-            Insert (const C &, bool = true)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value>
-            Insert (const C &entity, bool withId = true)
+        sqlite3_stmt *_GetUpdateStatement (const C &entity,
+            const std::vector<size_t> &keys, std::uint64_t keyMask)
         {
-            std::ostringstream os;
-            _GetInsert (os, entity, withId);
-            _connector->Execute (os.str ());
+            return _connector->Prepare ({
+                &BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                BOT_ORM_Impl::StatementKind::Update, keyMask
+            }, [this, &entity, &keys, keyMask] ()
+            {
+                const auto &fieldNames =
+                    BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+                const auto fixed = _GetFixedFields (entity, keys, keyMask);
+                std::string fields;
+                for (size_t index = 0; index < fieldNames.size (); index++)
+                    if (!_IsKey (fixed, index))
+                        fields += fieldNames[index].ToString () + "=?,";
+                fields.pop_back ();
+
+                return "update " +
+                    BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                    " set " + fields + _GetKeyParams (entity, keys) + ";";
+            });
         }
 
-        template <typename In, typename C = typename In::value_type>
-        std::enable_if_t<!HasInjected<C>::value>
-            InsertRange (const In &, bool = true)
-        {}
-        template <typename In, typename C = typename In::value_type>
-        std::enable_if_t<HasInjected<C>::value>
-            InsertRange (const In &entities, bool withId = true)
+        template <typename C>
+        sqlite3_stmt *_GetDeleteStatement (const C &entity,
+            const std::vector<size_t> &keys)
         {
-            std::ostringstream os;
-            auto anyEntity = false;
-            for (const auto &entity : entities)
+            return _connector->Prepare ({
+                &BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                BOT_ORM_Impl::StatementKind::Delete, 0
+            }, [&entity, &keys] ()
             {
-                _GetInsert (os, entity, withId);
-                anyEntity = true;
-            }
-            if (anyEntity)
-                _connector->Execute (os.str ());
+                return "delete from " +
+                    BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                    _GetKeyParams (entity, keys) + ";";
+            });
         }
 
         template <typename C>
-        std::enable_if_t<!HasInjected<C>::value>
-            Update (const C &)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value>
-            Update (const C &entity)
+        sqlite3_stmt *_GetDeleteInStatement (const C &entity,
+            size_t key, size_t paramCount)
         {
-            std::ostringstream os;
-            if (_GetUpdate (os, entity))
-                _connector->Execute (os.str ());
+            return _connector->Prepare ({
+                &BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                BOT_ORM_Impl::StatementKind::DeleteIn, paramCount
+            }, [&entity, key, paramCount] ()
+            {
+                std::string params;
+                for (size_t i = 0; i < paramCount; i++)
+                    params += "?,";
+                params.pop_back ();
+
+                return "delete from " +
+                    BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                    " where " + BOT_ORM_Impl::InjectionHelper::
+                    FieldNames (entity)[key].ToString () +
+                    " in (" + params + ");";
+            });
         }
 
-        template <typename In, typename C = typename In::value_type>
-        std::enable_if_t<!HasInjected<C>::value>
-            UpdateRange (const In &)
-        {}
-        template <typename In, typename C = typename In::value_type>
-        std::enable_if_t<HasInjected<C>::value>
-            UpdateRange (const In &entities)
+        // Power of 2 for Caching Few Statements,
+        // NOT Exceeding the Max Number of Parameters
+        size_t _GetChunkSize (size_t count) const
         {
-            std::ostringstream os, osTmp;
-            for (const auto &entity : entities)
-                if (_GetUpdate (osTmp, entity))
-                {
-                    os << osTmp.str ();
-                    osTmp.str (std::string {});  // Flush the previous data
-                }
-            auto sql = os.str ();
-            if (!sql.empty ()) _connector->Execute (sql);
+            auto maxSize = size_t (_connector->MaxVariables ());
+            size_t ret = 1;
+            while (ret < count && ret < maxSize)
+                ret <<= 1;
+            return std::min (ret, maxSize);
         }
 
         template <typename C>
-        std::enable_if_t<!HasInjected<C>::value>
-            Update (const C &,
-                const Expression::SetExpr &,
-                const Expression::Expr &)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value>
-            Update (const C &entity,
-                const Expression::SetExpr &setExpr,
-                const Expression::Expr &whereExpr)
+        sqlite3_stmt *_GetSelectStatement (const C &entity,
+            const std::vector<size_t> &keys, std::uint64_t keyMask)
         {
-            _connector->Execute (
-                "update " +
-                BOT_ORM_Impl::InjectionHelper::TableName (entity) +
-                " set " + setExpr.ToString () +
-                " where " +
-                whereExpr.ToString () + ";");
+            return _connector->Prepare ({
+                &BOT_ORM_Impl::InjectionHelper::TableName (entity),
+                BOT_ORM_Impl::StatementKind::Select, keyMask
+            }, [&entity, &keys] ()
+            {
+                std::string fields;
+                for (const auto &fieldName :
+                     BOT_ORM_Impl::InjectionHelper::FieldNames (entity))
+                    fields += fieldName.ToString () + ",";
+                fields.pop_back ();
+
+                return "select " + fields + " from " +
+                    BOT_ORM_Impl::InjectionHelper::TableName (entity) +
+                    _GetKeyParams (entity, keys) + ";";
+            });
         }
 
         template <typename C>
-        std::enable_if_t<!HasInjected<C>::value>
-            Delete (const C &)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value>
-            Delete (const C &entity)
+        static inline std::string _GetKeyParams (
+            const C &entity, const std::vector<size_t> &keys)
         {
             const auto &fieldNames =
                 BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
+            std::string ret = " where ";
+            for (size_t i = 0; i < keys.size (); i++)
+            {
+                if (i != 0)
+                    ret += " and ";
+                ret += fieldNames[keys[i]].ToString () + "=?";
+            }
+            return ret;
+        }
 
-            std::ostringstream os;
-            os << "delete from "
-                << BOT_ORM_Impl::InjectionHelper::TableName (entity)
-                << " where " << fieldNames[0] << "=";
-
-            // Primary Key
+        // Bind Fields of 'isBound (index)' from Parameter 1
+        template <typename C, typename Fn>
+        inline void _BindFields (sqlite3_stmt *stmt,
+            const C &entity, Fn isBound)
+        {
+            const auto &compressed = _GetCompressedFields (entity);
             BOT_ORM_Impl::InjectionHelper::Visit (
-                entity, [&os] (const auto &primaryKey,
-                    const auto & ... dummy)
-            {
-                // Why 'eatdummy'?
-                // Walkaround 'fatal error c1001:
-                // an internal error has occurred in the compiler.' on MSVC 14
-                auto eatdummy = [] (const auto &) {};
-                (void) eatdummy;
-
-                // Why 'dummy'?
-                // Walkaround 'template argument deduction/substitution failed'
-                // on gcc 5.4
-                (void) BOT_ORM_Impl::Expander
+                entity, [this, stmt, &isBound, &compressed] (
+                    const auto & ... args)
+            {
+                int param = 0;
+                auto bindField = [this, stmt, &isBound, &compressed,
+                    &param] (const auto &val, size_t index)
                 {
-                    0, (eatdummy (dummy), 0)...
+                    if (!isBound (index))
+                        return;
+                    if (index < compressed.size () && compressed[index])
+                        _BindCompressed (stmt, ++param, val);
+                    else
+                        BOT_ORM_Impl::BindingHelper::
+                        Bind (stmt, ++param, val);
                 };
 
-                if (!BOT_ORM_Impl::SerializationHelper::
-                    Serialize (os, primaryKey))
-                    os << "null";
+                size_t index = 0;
+                (void) BOT_ORM_Impl::Expander
+                {
+                    0, (bindField (args, index++), 0)...
+                };
+                (void) bindField;
             });
-            os << ";";
-
-            _connector->Execute (os.str ());
         }
 
-        template <typename C>
-        std::enable_if_t<!HasInjected<C>::value>
-            Delete (const C &,
-                const Expression::Expr &)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value>
-            Delete (const C &entity,
-                const Expression::Expr &whereExpr)
+        // Bind the Value of a Compressed Field
+        // (as it is if NOT Compressed Smaller)
+        template <typename T>
+        inline void _BindCompressed (sqlite3_stmt *stmt, int param,
+            const T &value)
         {
-            _connector->Execute (
-                "delete from " +
-                BOT_ORM_Impl::InjectionHelper::TableName (entity) +
-                " where " +
-                whereExpr.ToString () + ";");
+            BOT_ORM_Impl::BindingHelper::Bind (stmt, param, value);
         }
 
-        template <typename C>
-        std::enable_if_t<!HasInjected<C>::value, Queryable<C>>
-            Query (C)
-        {}
-        template <typename C>
-        std::enable_if_t<HasInjected<C>::value, Queryable<C>>
-            Query (C queryHelper)
+        inline void _BindCompressed (sqlite3_stmt *stmt, int param,
+            const std::string &value)
         {
-            return Queryable<C> (
-                _connector,
-                std::move (queryHelper),
-                std::string (" from ") +
-                BOT_ORM_Impl::InjectionHelper::TableName (queryHelper));
+            std::string compressed;
+            if (_connector->Compress (value, compressed))
+                BOT_ORM_Impl::BindingHelper::BindCopy (
+                    stmt, param, compressed);
+            else
+                BOT_ORM_Impl::BindingHelper::Bind (stmt, param, value);
         }
 
-    protected:
-        std::shared_ptr<BOT_ORM_Impl::SQLConnector> _connector;
-
-        static void _GetConstraints (
-            std::string &,
-            std::unordered_map<std::string, std::string> &)
-        {}
-
-        template <typename... Args>
-        static void _GetConstraints (
-            std::string &tableFixes,
-            std::unordered_map<std::string, std::string> &fieldFixes,
-            const Constraint &constraint,
-            const Args & ... args)
+        inline void _BindCompressed (sqlite3_stmt *stmt, int param,
+            const Nullable<std::string> &value)
         {
-            if (!constraint.field.empty ())
-                fieldFixes[constraint.field] += constraint.constraint;
+            if (value == nullptr)
+                BOT_ORM_Impl::BindingHelper::Bind (stmt, param, value);
             else
-                tableFixes += constraint.constraint + ",";
-            _GetConstraints (tableFixes, fieldFixes, args...);
+                _BindCompressed (stmt, param, value.Value ());
         }
 
+        // Bind Keys from Parameter 'firstParam'
         template <typename C>
-        static inline void _GetInsert (
-            std::ostream &os, const C &entity, bool withId)
+        static inline void _BindKeys (sqlite3_stmt *stmt,
+            const C &entity, const std::vector<size_t> &keys,
+            int firstParam)
         {
             BOT_ORM_Impl::InjectionHelper::Visit (
-                entity, [&os, &entity, withId] (
-                    const auto &primaryKey, const auto & ... args)
+                entity, [stmt, &keys, firstParam] (const auto & ... args)
             {
-                const auto &fieldNames =
-                    BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
-
-                os << "insert into "
-                    << BOT_ORM_Impl::InjectionHelper::TableName (entity)
-                    << "(";
-
-                std::ostringstream osVal;
-
-                // Avoid Bad Eating of ,
-                bool anyField = false;
-
-                auto serializeField =
-                    [&fieldNames, &os, &osVal, &anyField] (
-                        const auto &val, size_t index)
+                auto bindKey = [stmt, &keys, firstParam] (
+                    const auto &val, size_t index)
                 {
-                    if (BOT_ORM_Impl::SerializationHelper::
-                        Serialize (osVal, val))
-                    {
-                        os << fieldNames[index] << ",";
-                        osVal << ",";
-                        anyField = true;
-                    }
+                    auto key = std::find (keys.begin (), keys.end (), index);
+                    if (key != keys.end ())
+                        BOT_ORM_Impl::BindingHelper::Bind (stmt,
+                            firstParam + int (key - keys.begin ()), val);
                 };
 
-                // Priamry Key
-                if (withId &&
-                    BOT_ORM_Impl::SerializationHelper::
-                    Serialize (osVal, primaryKey))
-                {
-                    os << fieldNames[0] << ",";
-                    osVal << ",";
-                    anyField = true;
-                }
-
-                // The Rest
-                size_t index = 1;
-
+                size_t index = 0;
                 (void) BOT_ORM_Impl::Expander
                 {
-                    0, (serializeField (args, index++), 0)...
+                    0, (bindKey (args, index++), 0)...
                 };
-                (void) serializeField;
+                (void) bindKey;
+            });
+        }
 
-                if (anyField)
-                {
-                    os.seekp (os.tellp () - std::streamoff (1));
-                    osVal.seekp (osVal.tellp () - std::streamoff (1));
-                }
-                else  // Fix for No Field for Insert...
-                {
-                    os << fieldNames[0];
-                    osVal << "null";
-                }
+        static inline std::string _GetIndexName (
+            const std::string &tableName, const Constraint &index)
+        {
+            return "idx_" + tableName + "_" + index.index;
+        }
 
-                osVal << ");";  // To Enable Seekp...
-                os << ") values (" << osVal.str ();
-            });
+        static inline std::string _GetIndex (
+            const std::string &tableName, const Constraint &index)
+        {
+            if (index.index.empty ())
+                throw std::runtime_error (NOT_INDEX);
+            if (!index.fullText.empty ())
+                return _GetFullTextIndex (tableName, index.fullText);
+            if (!index.spatial.empty ())
+                return _GetSpatialIndex (tableName, index.spatial);
+            return "create index " + _GetIndexName (tableName, index) +
+                " on " + tableName + index.constraint + ";";
         }
 
-        template <typename C>
-        static inline bool _GetUpdate (
-            std::ostream &os, const C &entity)
+        // External-content FTS5 Table (Synchronized by Triggers)
+        static inline std::string _GetFullTextIndex (
+            const std::string &tableName, const std::string &field)
         {
-            return BOT_ORM_Impl::InjectionHelper::Visit (
-                entity, [&os, &entity] (
-                    const auto &primaryKey, const auto & ... args)
+            const auto name =
+                BOT_ORM_Impl::FullTextName (tableName, field);
+            const auto insertNew = "insert into " + name + "(rowid," +
+                field + ") values (new.rowid,new." + field + ");";
+            const auto deleteOld = "insert into " + name + "(" + name +
+                ",rowid," + field + ") values ('delete',old.rowid,old." +
+                field + ");";
+
+            return "create virtual table " + name + " using fts5(" +
+                field + ",content='" + tableName + "');" +
+                "insert into " + name + "(" + name +
+                ") values ('rebuild');" +
+                "create trigger " + name + "_insert after insert on " +
+                tableName + " begin " + insertNew + " end;" +
+                "create trigger " + name + "_delete after delete on " +
+                tableName + " begin " + deleteOld + " end;" +
+                "create trigger " + name + "_update after update on " +
+                tableName + " when old.rowid is not new.rowid or old." +
+                field + " is not new." + field + " begin " +
+                deleteOld + insertNew + " end;";
+        }
+
+        // R*Tree Table (Synchronized by Triggers)
+        // - Rows with Null or Inverted Bounds are NOT Indexed
+        static inline std::string _GetSpatialIndex (
+            const std::string &tableName, const std::string &bounds)
+        {
+            const auto name =
+                BOT_ORM_Impl::SpatialName (tableName, bounds);
+
+            std::string newBounds, newNotNull, notNull, changed;
+            const auto fields = BOT_ORM_Impl::SplitFields (bounds);
+            for (const auto &field : fields)
             {
-                if (sizeof... (args) == 0)
-                    return false;
+                newBounds += ",new." + field;
+                newNotNull += " and new." + field + " is not null";
+                notNull += " and " + field + " is not null";
+                changed += " or old." + field + " is not new." + field;
+            }
+
+            // R*Tree Rejects Inverted Boxes (Min > Max)
+            for (size_t i = 0; i + 1 < fields.size (); i += 2)
+            {
+                newNotNull += " and new." + fields[i] +
+                    "<=new." + fields[i + 1];
+                notNull += " and " + fields[i] + "<=" + fields[i + 1];
+            }
+            const auto insertNew = "insert into " + name +
+                " select new.rowid" + newBounds +
+                " where 1" + newNotNull + ";";
+            const auto deleteOld = "delete from " + name +
+                " where id=old.rowid;";
+            const auto rebuild = "insert into " + name +
+                " select rowid," + bounds + " from " + tableName +
+                " where 1" + notNull + ";";
+
+            return "create virtual table " + name + " using rtree(id," +
+                bounds + ");" + rebuild +
+                "create trigger " + name + "_insert after insert on " +
+                tableName + " begin " + insertNew + " end;" +
+                "create trigger " + name + "_delete after delete on " +
+                tableName + " begin " + deleteOld + " end;" +
+                "create trigger " + name + "_update after update on " +
+                tableName + " when old.rowid is not new.rowid" + changed +
+                " begin " + deleteOld + insertNew + " end;";
+        }
+
+        static inline std::string _DropSyncedIndex (
+            const std::string &name)
+        {
+            return "drop trigger " + name + "_insert;" +
+                "drop trigger " + name + "_delete;" +
+                "drop trigger " + name + "_update;" +
+                "drop table " + name + ";";
+        }
+
+        // Skip 'skippedKeys' if it's NOT nullptr
+        template <typename C>
+        static inline void _GetInsert (
+            BOT_ORM_Impl::SQLWriter &os, const C &entity,
+            const std::vector<size_t> *skippedKeys)
+        {
+            os << "insert into "
+                << BOT_ORM_Impl::InjectionHelper::TableName (entity)
+                << '(';
 
+            BOT_ORM_Impl::InjectionHelper::Visit (
+                entity, [&os, &entity, skippedKeys] (const auto & ... args)
+            {
                 const auto &fieldNames =
                     BOT_ORM_Impl::InjectionHelper::FieldNames (entity);
-                os << "update "
-                    << BOT_ORM_Impl::InjectionHelper::TableName (entity)
-                    << " set ";
 
-                auto serializeField = [&fieldNames, &os] (
+                auto isSet = [skippedKeys] (const auto &val, size_t index)
+                {
+                    return !_IsNull (val) &&
+                        !(skippedKeys && _IsKey (*skippedKeys, index));
+                };
+                auto writeField = [&os, &fieldNames, &isSet] (
                     const auto &val, size_t index)
                 {
-                    os << fieldNames[index] << "=";
-                    if (!BOT_ORM_Impl::SerializationHelper::
-                        Serialize (os, val))
-                        os << "null";
-                    os << ",";
+                    if (isSet (val, index))
+                        os << fieldNames[index] << ',';
                 };
+                auto writeValue = [&os, &isSet] (
+                    const auto &val, size_t index)
+                {
+                    if (isSet (val, index))
+                    {
+                        BOT_ORM_Impl::SerializationHelper::Serialize (os, val);
+                        os << ',';
+                    }
+                };
+                (void) writeField;
+                (void) writeValue;
 
-                // The Rest
-                size_t index = 1;
-
+                size_t index = 0;
                 (void) BOT_ORM_Impl::Expander
                 {
-                    0, (serializeField (args, index++), 0)...
+                    0, (writeField (args, index++), 0)...
                 };
-                (void) serializeField;
 
-                os.seekp (os.tellp () - std::streamoff (1));
+                // Fix for No Field for Insert...
+                if (os.Back () != ',')
+                {
+                    os << fieldNames[skippedKeys ? skippedKeys->front () : 0]
+                        << ") values (null);";
+                    return;
+                }
+
+                os.PopBack ();
+                os << ") values (";
 
-                // Primary Key
-                os << " where " << fieldNames[0] << "=";
-                if (!BOT_ORM_Impl::SerializationHelper::
-                    Serialize (os, primaryKey))
-                    os << "null";
+                index = 0;
+                (void) BOT_ORM_Impl::Expander
+                {
+                    0, (writeValue (args, index++), 0)...
+                };
 
-                os << ";";
-                return true;
+                os.PopBack ();
+                os << ");";
             });
         }
     };
@@ -1710,7 +6912,7 @@ namespace BOT_ORM
     class FieldExtractor
     {
         using pair_type = std::pair<
-            const std::string &,
+            BOT_ORM_Impl::StringView,
             const std::string &>;
 
         template <typename C>
@@ -1724,15 +6926,29 @@ namespace BOT_ORM
         template <typename C>
         std::enable_if_t<HasInjected<C>::value>
             Extract (const C &helper)
+        {
+            Extract (helper,
+                BOT_ORM_Impl::InjectionHelper::TableName (helper));
+        }
+        template <typename C>
+        std::enable_if_t<HasInjected<C>::value>
+            Extract (const NamedTable<C> &table)
+        {
+            // Shared by Copies of this Extractor
+            _tableNames.push_back (
+                std::make_shared<const std::string> (table.tableName));
+            Extract (table.helper, *_tableNames.back ());
+        }
+
+        template <typename C>
+        void Extract (const C &helper, const std::string &tableName)
         {
             BOT_ORM_Impl::InjectionHelper::Visit (
-                helper, [this, &helper] (
+                helper, [this, &helper, &tableName] (
                     const auto & ... args)
             {
                 const auto &fieldNames =
                     BOT_ORM_Impl::InjectionHelper::FieldNames (helper);
-                const auto &tableName =
-                    BOT_ORM_Impl::InjectionHelper::TableName (helper);
 
                 size_t index = 0;
                 (void) BOT_ORM_Impl::Expander
@@ -1761,7 +6977,7 @@ namespace BOT_ORM
         {
             const auto &result = Get (field);
             return Expression::Field<T> {
-                std::move (result.first), &result.second };
+                result.first.ToString (), &result.second };
         }
 
         template <typename T>
@@ -1770,11 +6986,12 @@ namespace BOT_ORM
         {
             const auto &result = Get (field);
             return Expression::NullableField<T> {
-                std::move (result.first), &result.second };
+                result.first.ToString (), &result.second };
         }
 
     private:
         std::unordered_map<const void *, pair_type> _map;
+        std::vector<std::shared_ptr<const std::string>> _tableNames;
 
         template <typename T>
         const pair_type &Get (const T &field) const
@@ -1785,6 +7002,45 @@ namespace BOT_ORM
     };
 }
 
+namespace BOT_ORM
+{
+    // Field of Member Pointer
+    // - Resolved by the Offsets of Fields (Computed Once for each Class)
+    // - Need NO Helper Object or Extractor
+    // - Each Call Scans the Offsets and Copies the Field Name,
+    //   so Keep the Result instead of Calling it in Hot Loops
+
+    template <typename C, typename T>
+    inline std::enable_if_t<
+        BOT_ORM_Impl::InjectionHelper::HasInjected<C>::value,
+        Expression::Field<T>>
+        FieldOf (T C::*member)
+    {
+        const auto &instance =
+            BOT_ORM_Impl::InjectionHelper::Layout<C> ().instance;
+        return Expression::Field<T> {
+            BOT_ORM_Impl::InjectionHelper::FieldNames (instance) [
+                BOT_ORM_Impl::InjectionHelper::FieldIndex (member)
+            ].ToString (),
+            &BOT_ORM_Impl::InjectionHelper::TableName (instance) };
+    }
+
+    template <typename C, typename T>
+    inline std::enable_if_t<
+        BOT_ORM_Impl::InjectionHelper::HasInjected<C>::value,
+        Expression::NullableField<T>>
+        FieldOf (Nullable<T> C::*member)
+    {
+        const auto &instance =
+            BOT_ORM_Impl::InjectionHelper::Layout<C> ().instance;
+        return Expression::NullableField<T> {
+            BOT_ORM_Impl::InjectionHelper::FieldNames (instance) [
+                BOT_ORM_Impl::InjectionHelper::FieldIndex (member)
+            ].ToString (),
+            &BOT_ORM_Impl::InjectionHelper::TableName (instance) };
+    }
+}
+
 // Clear Intra Macros
 #undef NO_ORMAP
 #undef BAD_TYPE
@@ -1793,5 +7049,23 @@ namespace BOT_ORM
 #undef BAD_COLUMN_COUNT
 #undef NULL_DESERIALIZE
 #undef NOT_SAME_TABLE
+#undef NOT_INDEX
+#undef NOT_UNIQUE
+#undef BAD_SPATIAL
+#undef BAD_BOX
+#undef NO_ROWID_INDEX
+#undef BAD_QUERY_PLAN
+#undef QUERY_TIMEOUT
+#undef QUERY_CANCELLED
+#undef NOT_WAL_MODE
+#undef NOT_IN_MEMORY
+#undef WRITE_ONLY_BLOB
+#undef BAD_BLOB
+#undef BAD_COMPRESSED
+
+#undef BAD_GROUP_KEY
+#undef NO_ORDER
+#undef BAD_SEEK_KEY
+#undef BAD_PAGE_TOKEN
 
 #endif // !BOT_ORM_H
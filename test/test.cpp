@@ -4,8 +4,12 @@
 // BOT Man, 2016
 
 #include <iostream>
+#include <cstdio>
 #include <memory>
 #include <string>
+#include <algorithm>
+#include <thread>
+#include <chrono>
 
 #include "../src/ormlite.h"
 using namespace BOT_ORM;
@@ -60,6 +64,91 @@ struct ModelD
     ORMAP ("ModelD", d_int);
 };
 
+struct ModelE
+{
+    int e_series;
+    long e_ts;
+    double e_value;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelE", e_series, e_ts, e_value);
+};
+
+struct ModelF
+{
+    int f_key;
+    std::string f_name;
+    Nullable<double> fn_weight;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelF", f_key, f_name, fn_weight);
+};
+
+struct ModelG
+{
+    int g_id;
+    double g_xmin, g_xmax;
+    double g_ymin, g_ymax;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelG", g_id, g_xmin, g_xmax, g_ymin, g_ymax);
+};
+
+struct ModelH
+{
+    int h_id;
+    Blob h_data;
+    Nullable<Blob> hn_data;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelH", h_id, h_data, hn_data);
+};
+
+// Write-only View of ModelH
+struct ModelHView
+{
+    int h_id;
+    BlobView h_data;
+    Nullable<BlobView> hn_data;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelH", h_id, h_data, hn_data);
+};
+
+// Text View of ModelH
+struct ModelHText
+{
+    int h_id;
+    std::string h_data;
+    Nullable<std::string> hn_data;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelH", h_id, h_data, hn_data);
+};
+
+struct ModelI
+{
+    int i_id;
+    std::string i_doc;
+    Nullable<std::string> in_doc;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelI", i_id, i_doc, in_doc);
+};
+
+// Field Names Spread over Lines
+struct ModelJ
+{
+    int j_1;
+    std::string jName;
+    Nullable<double> jn_value2;
+
+    // Inject ORM-Lite into this Class :-)
+    ORMAP ("ModelJ", j_1,
+        jName ,
+        jn_value2);
+};
+
 namespace detail
 {
     template<typename Model>
@@ -86,6 +175,15 @@ void ResetTables (const Model &model, const OtherModels &...models)
     ResetTables (models...);
 }
 
+void SetJournalMode (const char *mode)
+{
+    sqlite3 *db;
+    sqlite3_open (TESTDB, &db);
+    sqlite3_exec (db, (std::string ("PRAGMA journal_mode = ") +
+        mode + ";").c_str (), nullptr, nullptr, nullptr);
+    sqlite3_close (db);
+}
+
 TEST_CASE ("create/drop tables")
 {
     ResetTables (ModelA {}, ModelB {}, ModelC {}, ModelD {});
@@ -103,6 +201,41 @@ TEST_CASE ("create/drop tables")
     mapper.CreateTbl (ModelD {});
 }
 
+TEST_CASE ("field names")
+{
+    ModelJ mj;
+    auto field = FieldExtractor { mj };
+
+    // before
+    ResetTables (ModelJ {});
+
+    // Split at Compile-time
+    constexpr auto names =
+        BOT_ORM_Impl::SplitFieldNames<3> ("a_1, bName ,\tc");
+    static_assert (BOT_ORM_Impl::CountFieldNames ("a_1, bName ,\tc") == 3,
+        "Bad Field Count");
+    static_assert (names[1].size == 5 && names[2].data[0] == 'c',
+        "Bad Field Name");
+
+    const auto &fieldNames =
+        BOT_ORM_Impl::InjectionHelper::FieldNames (mj);
+    REQUIRE (fieldNames.size () == 3);
+    REQUIRE (fieldNames[0] == "j_1");
+    REQUIRE (fieldNames[1] == "jName");
+    REQUIRE (fieldNames[2] == "jn_value2");
+
+    // Columns are Named by the Split Names
+    ORMapper mapper (TESTDB);
+    mapper.Insert (ModelJ { 1, "one", 0.5 });
+    mapper.Insert (ModelJ { 2, "two", nullptr });
+    auto rows = mapper.Query (mj)
+        .Where (field (mj.jn_value2) == nullptr)
+        .ToVector ();
+    REQUIRE (rows.size () == 1);
+    REQUIRE (rows[0].j_1 == 2);
+    REQUIRE (rows[0].jName == "two");
+}
+
 TEST_CASE ("normal cases")
 {
     ModelA ma;
@@ -144,6 +277,1656 @@ TEST_CASE ("normal cases")
     REQUIRE (std::get<0> (firstTuple).Value () == firstIdExpected);
 }
 
+TEST_CASE ("indexes")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ORMapper mapper (TESTDB);
+    try { mapper.DropTbl (ModelA {}); }
+    catch (...) {}
+
+    // test
+    mapper.CreateTbl (ModelA {},
+        Constraint::Index (field (ma.a_double)),
+        Constraint::Index (Constraint::CompositeField {
+            field (ma.a_string), field (ma.a_double) }),
+        Constraint::Index (field (ma.an_int), field (ma.an_int) != nullptr));
+    mapper.CreateIndex (ModelA {}, Constraint::Index (Lower (field (ma.a_string))));
+
+    auto indexNames = std::vector<std::string> {};
+    {
+        sqlite3 *db;
+        sqlite3_open (TESTDB, &db);
+        sqlite3_exec (db,
+            "SELECT name FROM sqlite_master WHERE type = 'index' "
+            "AND tbl_name = 'ModelA' ORDER BY name;",
+            [] (void *names, int, char **argv, char **)
+        {
+            static_cast<std::vector<std::string> *> (names)
+                ->emplace_back (argv[0]);
+            return 0;
+        }, &indexNames, nullptr);
+        sqlite3_close (db);
+    }
+    REQUIRE (indexNames == std::vector<std::string> {
+        "idx_ModelA_a_double",
+        "idx_ModelA_a_string_a_double",
+        "idx_ModelA_an_int_where_ModelA_an_int_is_not_null_6f264b16",
+        "idx_ModelA_lower_a_string_58fa2fd2" });
+
+    // Predicates Differing only in Operators
+    mapper.CreateIndex (ModelA {}, Constraint::Index (
+        field (ma.a_string), field (ma.a_int) > 1));
+    mapper.CreateIndex (ModelA {}, Constraint::Index (
+        field (ma.a_string), field (ma.a_int) < 1));
+    mapper.CreateIndex (ModelA {}, Constraint::Index (
+        Upper (field (ma.a_string))));
+    mapper.DropIndex (ModelA {}, Constraint::Index (
+        field (ma.a_string), field (ma.a_int) > 1));
+    mapper.DropIndex (ModelA {}, Constraint::Index (
+        field (ma.a_string), field (ma.a_int) < 1));
+
+    mapper.Insert (ModelA { 0, "Hello", 1, 2, nullptr, nullptr }, false);
+    REQUIRE (mapper.Query (ModelA {})
+        .Where (Lower (field (ma.a_string)) == std::string ("hello"))
+        .Aggregate (Count ()).Value () == 1);
+
+    mapper.DropIndex (ModelA {}, Constraint::Index (field (ma.a_double)));
+    REQUIRE_THROWS_WITH (
+        mapper.DropIndex (ModelA {}, Constraint::Unique (field (ma.a_double))),
+        "Constraint is NOT an Index");
+}
+
+TEST_CASE ("composite primary key without rowid")
+{
+    ModelE me {};
+    auto field = FieldExtractor { me };
+
+    // before
+    ORMapper mapper (TESTDB);
+    try { mapper.DropTbl (ModelE {}); }
+    catch (...) {}
+
+    // test
+    mapper.CreateTbl (ModelE {},
+        Constraint::PrimaryKey (Constraint::CompositeField {
+            field (me.e_series), field (me.e_ts) }),
+        Constraint::WithoutRowid ());
+
+    mapper.InsertRange (std::vector<ModelE> {
+        { 1, 10, 1.0 }, { 1, 20, 2.0 }, { 2, 10, 3.0 } });
+    REQUIRE_THROWS (mapper.Insert (ModelE { 1, 10, 4.0 }));
+
+    // Only (1, 20) is Updated / Deleted
+    mapper.Update (ModelE { 1, 20, 5.0 });
+    REQUIRE (mapper.Query (ModelE {})
+        .Aggregate (Sum (field (me.e_value))).Value () == 9.0);
+    mapper.Delete (ModelE { 1, 20, 0 });
+    REQUIRE (mapper.Query (ModelE {})
+        .Aggregate (Count ()).Value () == 2);
+    REQUIRE (mapper.Query (ModelE {})
+        .Where (field (me.e_series) == 1)
+        .ToVector ()[0].e_value == 1.0);
+}
+
+TEST_CASE ("query plan advisor")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+
+    // test
+    ORMapper mapper (TESTDB);
+    mapper.InsertRange (std::vector<ModelA> {
+        { 1, "a", 1.0, 1, nullptr, nullptr },
+        { 2, "b", 2.0, 2, nullptr, nullptr } });
+
+    auto byDouble = mapper.Query (ModelA {})
+        .Where (field (ma.a_double) == 1.0);
+    auto plan = byDouble.Explain ();
+    REQUIRE (plan.size () == 1);
+    REQUIRE (plan[0].IsFullScan ());
+
+    auto reports = std::vector<QueryReport> {};
+    mapper.OnQuery ([&reports] (const QueryReport &report)
+    {
+        reports.push_back (report);
+    });
+    mapper.AdviseQuery ();
+
+    REQUIRE (byDouble.ToVector ().size () == 1);
+    REQUIRE (reports.size () == 1);
+    REQUIRE (reports[0].issues.size () == 1);
+    REQUIRE (reports[0].stats.fullScanSteps > 0);
+    REQUIRE (reports[0].stats.vmSteps > 0);
+
+    // Reading the whole Table is NOT an Issue
+    mapper.Query (ModelA {}).ToVector ();
+    REQUIRE (reports.back ().issues.empty ());
+
+    mapper.AdviseQuery (true, true);
+    REQUIRE_THROWS_WITH (mapper.Query (ModelA {})
+        .OrderBy (field (ma.a_double)).ToVector (),
+        "SQL error: 'Bad Query Plan: USE TEMP B-TREE FOR ORDER BY' "
+        "at 'select * from ModelA order by ModelA.a_double;'");
+
+    mapper.CreateIndex (ModelA {}, Constraint::Index (field (ma.a_double)));
+    REQUIRE (byDouble.ToVector ().size () == 1);
+    REQUIRE (reports.back ().issues.empty ());
+    REQUIRE_FALSE (byDouble.Explain ()[0].IsFullScan ());
+}
+
+TEST_CASE ("keyset pagination")
+{
+    ModelE me {};
+    auto field = FieldExtractor { me };
+
+    // before
+    ORMapper mapper (TESTDB);
+    try { mapper.DropTbl (ModelE {}); }
+    catch (...) {}
+    mapper.CreateTbl (ModelE {},
+        Constraint::PrimaryKey (Constraint::CompositeField {
+            field (me.e_series), field (me.e_ts) }));
+
+    auto entities = std::vector<ModelE> {};
+    for (int series = 0; series < 3; series++)
+        for (long ts = 0; ts < 5; ts++)
+            entities.push_back (ModelE { series, ts, 0.0 });
+    mapper.InsertRange (entities);
+
+    // test
+    auto query = mapper.Query (ModelE {})
+        .OrderByDescending (field (me.e_value))
+        .OrderBy (field (me.e_ts))
+        .OrderBy (field (me.e_series))
+        .Take (4);
+
+    auto walked = std::vector<std::pair<long, int>> {};
+    auto pages = 0;
+    std::string token;
+    while (true)
+    {
+        auto page = query.Resume (token).ToPage ();
+        if (page.rows.empty ())
+            break;
+
+        for (const auto &row : page.rows)
+            walked.emplace_back (row.e_ts, row.e_series);
+        token = page.nextToken;
+        pages++;
+    }
+    REQUIRE (pages == 4);
+    REQUIRE (walked.size () == entities.size ());
+    REQUIRE (std::is_sorted (walked.begin (), walked.end ()));
+
+    REQUIRE (mapper.Query (ModelE {})
+        .After (field (me.e_series), 1)
+        .ToVector ().size () == 5);
+    REQUIRE (mapper.Query (ModelE {})
+        .OrderBy (field (me.e_series)).OrderBy (field (me.e_ts))
+        .SeekAfter (1, 3L)
+        .ToVector ().size () == 6);
+
+    REQUIRE_THROWS_WITH (query.Resume ("1;drop table ModelE,1,2").ToPage (),
+        "Bad Page Token");
+    REQUIRE_THROWS_WITH (query.Resume ("1--,1,2").ToPage (),
+        "Bad Page Token");
+    REQUIRE_THROWS_WITH (query.Resume ("1e,1,2").ToPage (),
+        "Bad Page Token");
+    REQUIRE_THROWS_WITH (query.Resume ("x'abc',1,2").ToPage (),
+        "Bad Page Token");
+    REQUIRE (query.Resume ("-1.5e+3,4,2").ToPage ().rows.size () == 0);
+    REQUIRE_THROWS_WITH (query.SeekAfter (1),
+        "Seek Keys do NOT Match OrderBy");
+    REQUIRE_THROWS_WITH (mapper.Query (ModelE {}).ToPage (),
+        "Keyset Pagination requires OrderBy");
+
+    // Nullable Keys (Null First in Ascending Order)
+    ResetTables (ModelA {}, ModelH {});
+    ModelA ma;
+    ModelH mh;
+    auto fieldA = FieldExtractor { ma, mh };
+    std::vector<ModelA> dataA;
+    for (int i = 0; i < 7; i++)
+        dataA.push_back (ModelA { i, std::to_string (i), 0,
+            i % 3 ? Nullable<int> (i % 2) : nullptr, nullptr, nullptr });
+    mapper.InsertRange (dataA);
+
+    auto walk = [] (const Queryable<ModelA> &nullableQuery)
+    {
+        std::vector<int> ret;
+        std::string nullableToken;
+        while (true)
+        {
+            auto page = nullableQuery.Resume (nullableToken).ToPage ();
+            if (page.rows.empty ())
+                break;
+            for (const auto &row : page.rows)
+                ret.push_back (row.a_int);
+            nullableToken = page.nextToken;
+        }
+        return ret;
+    };
+    REQUIRE (walk (mapper.Query (ma)
+        .OrderBy (fieldA (ma.an_int))
+        .OrderBy (fieldA (ma.a_int))
+        .Take (2)) == std::vector<int> { 0, 3, 6, 2, 4, 1, 5 });
+    REQUIRE (walk (mapper.Query (ma)
+        .OrderByDescending (fieldA (ma.an_int))
+        .OrderBy (fieldA (ma.a_int))
+        .Take (2)) == std::vector<int> { 1, 5, 2, 4, 0, 3, 6 });
+    REQUIRE (mapper.Query (ma)
+        .OrderBy (fieldA (ma.an_int)).OrderBy (fieldA (ma.a_int))
+        .SeekAfter (Nullable<int> {}, 3)
+        .ToVector ().size () == 5);
+
+    // Blob Keys
+    mapper.InsertRange (std::vector<ModelH> {
+        ModelH { 1, Blob { 0x01, 0xFF }, nullptr },
+        ModelH { 2, Blob { 0x02 }, nullptr }
+    });
+    auto blobPage = mapper.Query (mh)
+        .OrderBy (fieldA (mh.h_data))
+        .Take (1).ToPage ();
+    REQUIRE (blobPage.nextToken == "X'01FF'");
+    REQUIRE (mapper.Query (mh)
+        .OrderBy (fieldA (mh.h_data))
+        .Resume (blobPage.nextToken)
+        .ToVector ()[0].h_id == 2);
+}
+
+TEST_CASE ("multiple aggregates")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+
+    ORMapper mapper (TESTDB);
+    mapper.InsertRange (std::vector<ModelA> {
+        { 1, "a", 1.0, 10, nullptr, nullptr },
+        { 2, "a", 2.0, 20, nullptr, nullptr },
+        { 3, "b", 4.0, nullptr, nullptr, nullptr } });
+
+    // test
+    auto reports = 0;
+    mapper.OnQuery ([&reports] (const QueryReport &) { reports++; });
+
+    auto stats = mapper.Query (ModelA {})
+        .Where (field (ma.a_int) > 1)
+        .Aggregate (Count (), Sum (field (ma.a_double)),
+            Max (field (ma.a_double)), Min (field (ma.an_int)));
+    REQUIRE (reports == 1);
+    REQUIRE (std::get<0> (stats).Value () == 2);
+    REQUIRE (std::get<1> (stats).Value () == 6.0);
+    REQUIRE (std::get<2> (stats).Value () == 4.0);
+    REQUIRE (std::get<3> (stats).Value () == 20);
+
+    auto groups = mapper.Query (ModelA {})
+        .GroupAggregate (field (ma.a_string),
+            Count (), Avg (field (ma.a_double)), Sum (field (ma.an_int)));
+    REQUIRE (groups.size () == 2);
+    REQUIRE (std::get<0> (groups["a"]).Value () == 2);
+    REQUIRE (std::get<1> (groups["a"]).Value () == 1.5);
+    REQUIRE (std::get<2> (groups["a"]).Value () == 30);
+    REQUIRE (std::get<2> (groups["b"]) == nullptr);
+
+    // Nullable Keys, and NULL Groups Skipped for Other Keys
+    auto nullableGroups = mapper.Query (ModelA {})
+        .GroupAggregate (field (ma.an_int), Count ());
+    REQUIRE (nullableGroups.size () == 3);
+    REQUIRE (std::get<0> (nullableGroups[nullptr]).Value () == 1);
+    REQUIRE (std::get<0> (nullableGroups[10]).Value () == 1);
+
+    auto nonNullGroups = mapper.Query (ModelA {})
+        .GroupAggregate (Field<int> { "an_int", nullptr }, Count ());
+    REQUIRE (nonNullGroups.size () == 2);
+
+    // Refining Groups of GroupBy
+    auto refined = mapper.Query (ModelA {})
+        .GroupBy (field (ma.a_string))
+        .Having (Count () > size_t (1))
+        .GroupAggregate (field (ma.a_string), Sum (field (ma.a_int)));
+    REQUIRE (refined.size () == 1);
+    REQUIRE (std::get<0> (refined["a"]).Value () == 3);
+    REQUIRE_THROWS_WITH (mapper.Query (ModelA {})
+        .GroupBy (field (ma.a_int))
+        .GroupAggregate (field (ma.a_string), Count ()),
+        "SQL error: 'Key does NOT Identify the Groups' at "
+        "'select ModelA.a_string,count (*) from ModelA "
+        "group by ModelA.a_int,ModelA.a_string;'");
+}
+
+TEST_CASE ("field of member pointer")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+
+    ORMapper mapper (TESTDB);
+    mapper.InsertRange (std::vector<ModelA> {
+        { 1, "a", 1.0, 10, nullptr, nullptr },
+        { 2, "b", 2.0, nullptr, nullptr, nullptr } });
+
+    // test
+    auto aString = FieldOf (&ModelA::a_string);
+    REQUIRE (aString.fieldName == field (ma.a_string).fieldName);
+    REQUIRE (aString.tableName == field (ma.a_string).tableName);
+
+    REQUIRE (mapper.Query (ModelA {})
+        .Where (FieldOf (&ModelA::a_string) == std::string ("b") &&
+            FieldOf (&ModelA::an_int) == nullptr)
+        .Aggregate (Count ()).Value () == 1);
+    REQUIRE (mapper.Query (ModelA {})
+        .Where (FieldOf (&ModelA::a_double) > 1.5)
+        .ToVector ()[0].a_int == 2);
+}
+
+TEST_CASE ("prepared statements")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    {
+        ORMapper mapper (TESTDB);
+        try { mapper.DropTbl (ModelA {}); }
+        catch (...) {}
+
+        REQUIRE_THROWS (mapper.Register<ModelA> ());
+        mapper.CreateTbl (ModelA {},
+            Constraint::Default (field (ma.an_double), 0.5));
+    }
+
+    ORMapper mapper (TESTDB);
+    mapper.Register<ModelA> ();
+
+    auto keyOf = [] (int id)
+    {
+        ModelA ret {};
+        ret.a_int = id;
+        return ret;
+    };
+
+    // test
+    mapper.Insert (ModelA { 1, "a", 1.0, 10, nullptr, "n" });
+    mapper.Insert (ModelA { 0, "b", 2.0, nullptr, nullptr, nullptr }, false);
+    REQUIRE_THROWS (mapper.Insert (keyOf (1)));
+
+    auto a1 = mapper.Find (keyOf (1));
+    REQUIRE_FALSE (a1 == nullptr);
+    REQUIRE (a1.Value ().a_string == "a");
+    REQUIRE (a1.Value ().an_int == 10);
+    REQUIRE (a1.Value ().an_double == 0.5);
+    REQUIRE (a1.Value ().an_string == std::string ("n"));
+
+    auto a2 = mapper.Find (keyOf (2));
+    REQUIRE_FALSE (a2 == nullptr);
+    REQUIRE (a2.Value ().a_double == 2.0);
+    REQUIRE (a2.Value ().an_int == nullptr);
+
+    mapper.Update (ModelA { 2, "c", 3.0, 30, nullptr, nullptr });
+    REQUIRE (mapper.Find (keyOf (2)).Value ().a_string == "c");
+    REQUIRE (mapper.Find (keyOf (2)).Value ().an_double == nullptr);
+
+    mapper.Delete (keyOf (1));
+    REQUIRE (mapper.Find (keyOf (1)) == nullptr);
+    REQUIRE (mapper.Query (ModelA {}).Aggregate (Count ()).Value () == 1);
+}
+
+TEST_CASE ("sql literals")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+
+    ORMapper mapper (TESTDB);
+
+    // test
+    mapper.InsertRange (std::vector<ModelA> {
+        { 1, "it's", 0.1 + 0.2, -2147483647 - 1, 1e300, nullptr },
+        { 2, "b", 1.0, nullptr, nullptr, nullptr } });
+
+    ModelA key {};
+    key.a_int = 1;
+    auto a1 = mapper.Find (key).Value ();
+    REQUIRE (a1.a_string == "it's");
+    REQUIRE (a1.a_double == 0.1 + 0.2);
+    REQUIRE (a1.an_int == -2147483647 - 1);
+    REQUIRE (a1.an_double == 1e300);
+
+    mapper.Update (ma, field (ma.a_double) = 1.0 / 3,
+        field (ma.a_string) == std::string ("b"));
+    REQUIRE (mapper.Query (ma)
+        .Where (field (ma.a_double) == 1.0 / 3)
+        .ToVector ()[0].a_int == 2);
+}
+
+TEST_CASE ("upsert")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    {
+        ORMapper mapper (TESTDB);
+        try { mapper.DropTbl (ModelA {}); }
+        catch (...) {}
+        mapper.CreateTbl (ModelA {},
+            Constraint::Unique (field (ma.a_string)));
+    }
+
+    ORMapper mapper (TESTDB);
+    auto countOf = [&] (const std::string &str)
+    {
+        return mapper.Query (ma)
+            .Where (field (ma.a_string) == str)
+            .Aggregate (Count ()).Value ();
+    };
+
+    // test
+    mapper.Upsert (ModelA { 1, "a", 1.0, nullptr, nullptr, nullptr });
+    mapper.Upsert (ModelA { 1, "b", 2.0, 10, nullptr, nullptr });
+    REQUIRE (countOf ("a") == 0);
+    REQUIRE (countOf ("b") == 1);
+
+    mapper.UpsertRange (std::vector<ModelA> {
+        { 1, "c", 3.0, nullptr, nullptr, nullptr },
+        { 2, "d", 4.0, nullptr, nullptr, nullptr } });
+    REQUIRE (countOf ("b") == 0);
+    REQUIRE (countOf ("c") == 1);
+    REQUIRE (countOf ("d") == 1);
+
+    // Conflict on Unique Field (Primary Key is Kept)
+    mapper.Upsert (ModelA { 3, "d", 5.0, nullptr, nullptr, nullptr },
+        Constraint::Unique (field (ma.a_string)));
+    REQUIRE (countOf ("d") == 1);
+    auto upserted = mapper.Query (ma)
+        .Where (field (ma.a_string) == std::string ("d"))
+        .ToVector ();
+    REQUIRE (upserted[0].a_int == 2);
+    REQUIRE (upserted[0].a_double == 5.0);
+
+    mapper.Transaction ([&] ()
+    {
+        mapper.UpsertRange (std::vector<ModelA> {
+            { 4, "e", 6.0, nullptr, nullptr, nullptr },
+            { 5, "c", 7.0, nullptr, nullptr, nullptr } },
+            Constraint::Unique (field (ma.a_string)));
+    });
+    REQUIRE (countOf ("e") == 1);
+    REQUIRE (mapper.Query (ma).Aggregate (Count ()).Value () == 3);
+
+    REQUIRE_THROWS (mapper.Upsert (ModelA {},
+        Constraint::Check (field (ma.a_int) > 0)));
+}
+
+TEST_CASE ("generated row ids")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+
+    ORMapper mapper (TESTDB);
+
+    // test
+    REQUIRE (mapper.Insert (
+        ModelA { 5, "a", 1.0, nullptr, nullptr, nullptr }) == 5);
+    REQUIRE (mapper.Insert (
+        ModelA { 0, "b", 2.0, nullptr, nullptr, nullptr }, false) == 6);
+
+    auto ids = mapper.InsertRange (std::vector<ModelA> {
+        { 0, "c", 3.0, nullptr, nullptr, nullptr },
+        { 0, "d", 4.0, nullptr, nullptr, nullptr } }, false);
+    REQUIRE (ids == std::vector<long long> { 7, 8 });
+    REQUIRE (mapper.Query (ma)
+        .Where (field (ma.a_int) == 8)
+        .ToVector ()[0].a_string == "d");
+
+    REQUIRE (mapper.InsertRange (std::vector<ModelA> {}).empty ());
+}
+
+TEST_CASE ("range by primary key")
+{
+    ModelD md {};
+    ModelE me {};
+    auto field = FieldExtractor { md, me };
+
+    // before
+    ResetTables (ModelD {});
+
+    ORMapper mapper (TESTDB);
+    try { mapper.DropTbl (ModelE {}); }
+    catch (...) {}
+    mapper.CreateTbl (ModelE {},
+        Constraint::PrimaryKey (Constraint::CompositeField {
+            field (me.e_series), field (me.e_ts) }));
+
+    // test
+    std::vector<ModelD> dataD;
+    for (int i = 0; i < 2000; i++)
+        dataD.push_back (ModelD { i });
+    mapper.InsertRange (dataD);
+
+    // More than a Chunk of Parameters
+    dataD.resize (1500);
+    mapper.DeleteRange (dataD);
+    REQUIRE (mapper.Query (md).Aggregate (Count ()).Value () == 500);
+    REQUIRE (mapper.Query (md)
+        .Aggregate (Min (field (md.d_int))).Value () == 1500);
+
+    mapper.DeleteRange (std::vector<ModelD> { { 1500 }, { 1999 } });
+    REQUIRE (mapper.Query (md).Aggregate (Count ()).Value () == 498);
+    mapper.DeleteRange (std::vector<ModelD> {});
+
+    mapper.InsertRange (std::vector<ModelE> {
+        { 1, 10, 1.0 }, { 1, 20, 2.0 }, { 2, 10, 3.0 } });
+    mapper.UpdateRange (std::vector<ModelE> {
+        { 1, 10, 4.0 }, { 2, 10, 5.0 } });
+    REQUIRE (mapper.Query (me)
+        .Aggregate (Sum (field (me.e_value))).Value () == 11.0);
+
+    mapper.DeleteRange (std::vector<ModelE> {
+        { 1, 10, 0 }, { 2, 10, 0 }, { 2, 20, 0 } });
+    auto rest = mapper.Query (me).ToVector ();
+    REQUIRE (rest.size () == 1);
+    REQUIRE (rest[0].e_ts == 20);
+}
+
+TEST_CASE ("query timeout and cancellation")
+{
+    ModelC mc {};
+    ModelD md {};
+    auto field = FieldExtractor { mc, md };
+
+    // before
+    ResetTables (ModelA {}, ModelC {}, ModelD {});
+
+    ORMapper mapper (TESTDB);
+    std::vector<ModelC> dataC;
+    std::vector<ModelD> dataD;
+    for (int i = 0; i < 1000; i++)
+    {
+        dataC.push_back (ModelC { unsigned (i), i, 0 });
+        dataD.push_back (ModelD { i });
+    }
+    mapper.InsertRange (dataC);
+    mapper.InsertRange (dataD);
+
+    // 10^9 Rows to Count
+    auto slowQuery = mapper.Query (md)
+        .Join (mc, field (md.d_int) != field (mc.a_int))
+        .Join (ModelA {}, field (md.d_int) != field (mc.a_int));
+    mapper.Insert (ModelA { 1, "a", 1.0, nullptr, nullptr, nullptr });
+
+    // test
+    auto fastQuery = mapper.Query (md)
+        .WithTimeout (std::chrono::milliseconds (10000));
+    REQUIRE (fastQuery.Aggregate (Count ()).Value () == 1000);
+
+    try
+    {
+        slowQuery.WithTimeout (std::chrono::milliseconds (50))
+            .Aggregate (Count ());
+        FAIL ("Query is NOT Interrupted");
+    }
+    catch (const QueryInterrupted &ex)
+    {
+        REQUIRE (ex.TimedOut ());
+    }
+
+    // Nested Query does NOT Remove the Outer Timeout
+    auto nested = mapper.RegisterFunction ("nested_count",
+        [&fastQuery] (int value)
+    {
+        return value + (int) fastQuery.Aggregate (Count ()).Value ();
+    });
+    try
+    {
+        mapper.Query (md)
+            .Join (mc, field (md.d_int) != field (mc.a_int))
+            .Where (nested (field (md.d_int)) >= 0)
+            .WithTimeout (std::chrono::milliseconds (50))
+            .Aggregate (Count ());
+        FAIL ("Query is NOT Interrupted");
+    }
+    catch (const QueryInterrupted &ex)
+    {
+        REQUIRE (ex.TimedOut ());
+    }
+
+    CancellationToken token;
+    std::thread canceller ([token]
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (50));
+        token.Cancel ();
+    });
+    try
+    {
+        slowQuery.WithCancellation (token).Aggregate (Count ());
+        canceller.join ();
+        FAIL ("Query is NOT Interrupted");
+    }
+    catch (const QueryInterrupted &ex)
+    {
+        canceller.join ();
+        REQUIRE_FALSE (ex.TimedOut ());
+    }
+
+    REQUIRE (token.IsCancelled ());
+    REQUIRE_THROWS_AS (mapper.Query (md).WithCancellation (token)
+        .ToVector (), QueryInterrupted);
+}
+
+TEST_CASE ("parallel scan")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+    SetJournalMode ("WAL");
+
+    // test
+    {
+        ORMapper mapper (TESTDB);
+        std::vector<ModelA> dataA;
+        for (int i = 0; i < 1000; i++)
+            dataA.push_back (ModelA { i, std::to_string (i), i * 0.5,
+                i % 3 ? Nullable<int> (i) : nullptr, nullptr, nullptr });
+        mapper.InsertRange (dataA);
+
+        auto serial = mapper.Query (ma)
+            .Where (field (ma.a_int) > 100);
+        auto parallel = serial.Parallel (4);
+
+        size_t reported = 0;
+        mapper.OnQuery ([&reported] (const QueryReport &)
+        {
+            reported++;
+        });
+
+        auto rows = parallel.ToVector ();
+        REQUIRE (reported == 0);
+        auto expected = serial.ToVector ();
+        REQUIRE (rows.size () == 899);
+        REQUIRE (std::equal (rows.begin (), rows.end (), expected.begin (),
+            [] (const ModelA &lhs, const ModelA &rhs)
+        {
+            return lhs.a_int == rhs.a_int && lhs.an_int == rhs.an_int;
+        }));
+        REQUIRE (parallel.ToList ().size () == 899);
+
+        REQUIRE (parallel.Aggregate (Count ()) ==
+            serial.Aggregate (Count ()));
+        REQUIRE (parallel.Aggregate (Count (field (ma.an_int))) ==
+            serial.Aggregate (Count (field (ma.an_int))));
+        REQUIRE (parallel.Aggregate (Sum (field (ma.an_int))) ==
+            serial.Aggregate (Sum (field (ma.an_int))));
+        REQUIRE (parallel.Aggregate (Min (field (ma.an_int))) ==
+            serial.Aggregate (Min (field (ma.an_int))));
+        REQUIRE (parallel.Aggregate (Max (field (ma.a_double))) ==
+            serial.Aggregate (Max (field (ma.a_double))));
+        REQUIRE (parallel.Aggregate (Avg (field (ma.a_double))) ==
+            serial.Aggregate (Avg (field (ma.a_double))));
+        REQUIRE (parallel.Aggregate (Sum (field (ma.an_double))) == nullptr);
+        REQUIRE (parallel.Aggregate (Max (field (ma.a_string))) ==
+            serial.Aggregate (Max (field (ma.a_string))));
+
+        // Fall back to Serial Scan
+        REQUIRE (parallel.OrderByDescending (field (ma.a_int))
+            .Take (1).ToVector ()[0].a_int == 999);
+
+        // Uncommitted Changes are Visible in Transactions
+        mapper.Transaction ([&] ()
+        {
+            mapper.Insert (ModelA { 1000, "1000", 500,
+                nullptr, nullptr, nullptr });
+            reported = 0;
+            REQUIRE (parallel.ToVector ().size () == 900);
+            REQUIRE (parallel.Aggregate (Count ()).Value () == 900);
+            REQUIRE (reported == 2);
+        });
+        REQUIRE (parallel.ToVector ().size () == 900);
+    }
+
+    // Partitions only in WAL Mode
+    SetJournalMode ("DELETE");
+
+    ORMapper mapper (TESTDB);
+    size_t reported = 0;
+    mapper.OnQuery ([&reported] (const QueryReport &)
+    {
+        reported++;
+    });
+    REQUIRE (mapper.Query (ma).Where (field (ma.a_int) > 100)
+        .Parallel (4).ToVector ().size () == 900);
+    REQUIRE (reported == 1);
+}
+
+TEST_CASE ("read snapshot")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+    SetJournalMode ("WAL");
+
+    // test
+    {
+        ORMapper mapper (TESTDB);
+        std::vector<ModelA> dataA;
+        for (int i = 0; i < 100; i++)
+            dataA.push_back (ModelA { i, std::to_string (i), i * 0.5,
+                nullptr, nullptr, nullptr });
+        mapper.InsertRange (dataA);
+
+        auto snapshot = mapper.Snapshot ();
+        mapper.Insert (ModelA { 100, "100", 50, nullptr, nullptr, nullptr });
+        mapper.Delete (dataA.front ());
+
+        auto current = mapper.Query (ma);
+        auto pinned = snapshot.Query (ma);
+        REQUIRE (current.Aggregate (Count ()).Value () == 100);
+        REQUIRE (pinned.Aggregate (Count ()).Value () == 100);
+        REQUIRE (pinned.Aggregate (Min (field (ma.a_int))).Value () == 0);
+        REQUIRE (pinned.Aggregate (Max (field (ma.a_int))).Value () == 99);
+
+        // Partitions Read the Same Snapshot
+        mapper.Insert (ModelA { 101, "101", 50, nullptr, nullptr, nullptr });
+        auto rows = pinned.Parallel (4).ToVector ();
+        REQUIRE (rows.size () == 100);
+        REQUIRE (rows.front ().a_int == 0);
+        REQUIRE (rows.back ().a_int == 99);
+        REQUIRE (pinned.Parallel (4).Aggregate (
+            Sum (field (ma.a_int))).Value () == 4950);
+        REQUIRE (current.Parallel (4).Aggregate (
+            Count ()).Value () == 101);
+    }
+
+    // after
+    SetJournalMode ("DELETE");
+
+    ORMapper mapper (TESTDB);
+    REQUIRE_THROWS_WITH (mapper.Snapshot (), "Snapshot requires WAL Mode");
+}
+
+TEST_CASE ("background checkpoint")
+{
+    // before
+    ResetTables (ModelD {});
+    SetJournalMode ("WAL");
+
+    // test
+    {
+        ORMapper mapper (TESTDB);
+        REQUIRE (mapper.CheckpointMetrics ().checkpoints == 0);
+
+        mapper.CheckpointInBackground (
+            true, std::chrono::milliseconds (50), 4);
+        for (int i = 0; i < 20; i++)
+            mapper.Insert (ModelD { i });
+
+        auto waitFor = [&mapper] (bool (*done) (const CheckpointStats &))
+        {
+            for (int i = 0; i < 100; i++)
+            {
+                if (done (mapper.CheckpointMetrics ()))
+                    return true;
+                std::this_thread::sleep_for (
+                    std::chrono::milliseconds (20));
+            }
+            return false;
+        };
+
+        // PASSIVE after Commits
+        REQUIRE (waitFor ([] (const CheckpointStats &stats)
+        {
+            return stats.checkpoints > 0 && stats.framesCheckpointed > 0;
+        }));
+
+        // TRUNCATE when Idle
+        REQUIRE (waitFor ([] (const CheckpointStats &stats)
+        {
+            return stats.truncations > 0 && stats.walFrames == 0;
+        }));
+
+        auto stats = mapper.CheckpointMetrics ();
+        REQUIRE (stats.lastError.empty ());
+        REQUIRE (stats.elapsed.count () > 0);
+
+        mapper.CheckpointInBackground (false);
+        REQUIRE (mapper.CheckpointMetrics ().checkpoints == 0);
+        REQUIRE (mapper.Query (ModelD {}).Aggregate (
+            Count ()).Value () == 20);
+    }
+
+    // after
+    SetJournalMode ("DELETE");
+}
+
+TEST_CASE ("backup and restore")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+    std::remove ("backup.db");
+
+    // test
+    ORMapper mapper (TESTDB);
+    std::vector<ModelA> dataA;
+    for (int i = 0; i < 1000; i++)
+        dataA.push_back (ModelA { i, std::string (100, 'a'), i * 0.5,
+            nullptr, nullptr, nullptr });
+    mapper.InsertRange (dataA);
+
+    std::vector<std::pair<int, int>> steps;
+    mapper.Backup ("backup.db", 4, std::chrono::milliseconds (0),
+        [&] (int remaining, int total)
+    {
+        // Written during the Backup
+        if (steps.empty ())
+            mapper.Insert (ModelA { 1000, "1000", 500,
+                nullptr, nullptr, nullptr });
+        steps.emplace_back (remaining, total);
+    });
+    REQUIRE (steps.size () > 1);
+    REQUIRE (steps.back ().first == 0);
+
+    ORMapper restored (":memory:");
+    restored.Restore ("backup.db");
+    REQUIRE (restored.Query (ma).Aggregate (Count ()).Value () == 1001);
+    REQUIRE (restored.Query (ma)
+        .Where (field (ma.a_int) == 1000)
+        .ToVector ().size () == 1);
+
+    // Primary Key is Reloaded after Restore
+    std::remove ("keyed.db");
+    {
+        ORMapper keyed ("keyed.db");
+        keyed.CreateTbl (ma, Constraint::PrimaryKey (field (ma.a_string)));
+        keyed.Insert (ModelA { 1, "key", 1.0, nullptr, nullptr, nullptr });
+    }
+    mapper.Update (dataA[0]);
+    mapper.Restore ("keyed.db");
+    mapper.Update (ModelA { 2, "key", 2.0, nullptr, nullptr, nullptr });
+    REQUIRE (mapper.Query (ma).ToVector ()[0].a_int == 2);
+
+    REQUIRE_THROWS (mapper.Backup ("no_such_dir/backup.db"));
+}
+
+TEST_CASE ("write behind")
+{
+    ModelD md {};
+
+    // before
+    std::remove ("memory.db");
+
+    // test
+    {
+        ORMapper mapper (":memory:");
+        mapper.WriteBehind ("memory.db", std::chrono::milliseconds (20));
+
+        // Schema Changes are Flushed as well
+        mapper.CreateTbl (ModelD {});
+        auto flushed = false;
+        for (int i = 0; i < 100 && !flushed; i++)
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (20));
+            ORMapper file ("memory.db");
+            try
+            {
+                flushed = file.Query (md).Aggregate (Count ()).Value () == 0;
+            }
+            catch (const std::exception &) {}  // NOT Flushed yet
+        }
+        REQUIRE (flushed);
+        REQUIRE (mapper.Flush ());
+
+        mapper.Insert (ModelD { 1 });
+        flushed = false;
+        for (int i = 0; i < 100 && !flushed; i++)
+        {
+            std::this_thread::sleep_for (std::chrono::milliseconds (20));
+            ORMapper file ("memory.db");
+            flushed = file.Query (md).Aggregate (Count ()).Value () == 1;
+        }
+        REQUIRE (flushed);
+
+        // Skipped in a Transaction
+        mapper.Transaction ([&] ()
+        {
+            mapper.Insert (ModelD { 2 });
+            REQUIRE_FALSE (mapper.Flush ());
+        });
+        mapper.Insert (ModelD { 3 });
+    }
+
+    // Flushed at the End and Loaded at the Start
+    {
+        ORMapper mapper (":memory:");
+        mapper.WriteBehind ("memory.db");
+        REQUIRE (mapper.Query (md).Aggregate (Count ()).Value () == 3);
+    }
+
+    ORMapper file ("memory.db");
+    REQUIRE_FALSE (file.Flush ());
+    REQUIRE_THROWS_WITH (file.WriteBehind ("other.db"),
+        "Write-behind requires an In-memory Database");
+}
+
+TEST_CASE ("change data capture")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {}, ModelD {});
+    std::remove ("replica.db");
+
+    // test
+    ORMapper mapper (TESTDB);
+    std::vector<RowChange> changes;
+    mapper.OnChange (ModelA {}, [&changes] (const RowChange &change)
+    {
+        changes.push_back (change);
+    });
+    mapper.RecordChanges (ModelA {});
+
+    auto row = [] (int id)
+    {
+        return ModelA { id, std::to_string (id), id * 0.5,
+            nullptr, nullptr, nullptr };
+    };
+
+    mapper.Insert (row (1));
+    mapper.Insert (ModelD { 1 });  // NOT Listened
+    REQUIRE (changes.size () == 1);
+    REQUIRE (changes[0].operation == RowChange::Operation::Insert);
+    REQUIRE (changes[0].table == "ModelA");
+    REQUIRE (changes[0].rowid == 1);
+
+    // Buffered until Commit
+    mapper.Transaction ([&] ()
+    {
+        mapper.InsertRange (std::vector<ModelA> { row (2), row (3) });
+        mapper.Update (ModelA {}, field (ma.a_string) = "two",
+            field (ma.a_int) == 2);
+        mapper.Delete (row (1));
+        REQUIRE (changes.size () == 1);
+    });
+    REQUIRE (changes.size () == 5);
+    REQUIRE (changes[3].operation == RowChange::Operation::Update);
+    REQUIRE (changes[3].rowid == 2);
+    REQUIRE (changes[4].operation == RowChange::Operation::Delete);
+    REQUIRE (changes[4].rowid == 1);
+
+    // Dropped at Rollback
+    REQUIRE_THROWS (mapper.Transaction ([&] ()
+    {
+        mapper.Insert (row (4));
+        throw std::runtime_error ("rollback");
+    }));
+    REQUIRE (changes.size () == 5);
+
+    // Replay the Changeset on another Database
+    auto changeset = mapper.ExportChangeset ();
+    REQUIRE_FALSE (changeset.empty ());
+    REQUIRE (mapper.ExportChangeset ().empty ());
+
+    ORMapper replica ("replica.db");
+    replica.CreateTbl (ModelA {});
+    replica.ApplyChangeset (changeset);
+
+    auto rows = replica.Query (ma)
+        .OrderBy (field (ma.a_int)).ToVector ();
+    REQUIRE (rows.size () == 2);
+    REQUIRE (rows[0].a_string == "two");
+    REQUIRE (rows[1].a_int == 3);
+
+    // Conflicts Abort
+    REQUIRE_THROWS (replica.ApplyChangeset (changeset));
+
+    // Changes of Failed Statements are Dropped
+    mapper.Transaction ([&] ()
+    {
+        REQUIRE_THROWS (mapper.Update (ModelA {},
+            field (ma.a_int) = 10, field (ma.a_int) >= 2));
+        mapper.Insert (row (5));
+    });
+    REQUIRE (changes.size () == 6);
+    REQUIRE (changes[5].rowid == 5);
+
+    // Errors of Listeners are Rethrown after all Listeners
+    mapper.OnChange (ModelA {}, [] (const RowChange &change)
+    {
+        if (change.rowid == 6)
+            throw std::runtime_error ("listener error");
+    });
+    REQUIRE_THROWS_WITH (mapper.Transaction ([&] ()
+    {
+        mapper.InsertRange (std::vector<ModelA> { row (6), row (7) });
+    }), "listener error");
+    REQUIRE (changes.size () == 8);
+    REQUIRE (mapper.Query (ma).Aggregate (Count ()).Value () == 5);
+
+    // Listeners may Write to the Same Table
+    ORMapper writer (TESTDB);
+    writer.OnChange (ModelA {}, [&writer, &row] (const RowChange &change)
+    {
+        if (change.rowid == 8)
+            writer.Insert (row (9));
+    });
+    writer.Insert (row (8));
+    REQUIRE (writer.Query (ma).Aggregate (Count ()).Value () == 7);
+}
+
+TEST_CASE ("user functions")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+    SetJournalMode ("WAL");
+
+    // test
+    {
+        ORMapper mapper (TESTDB);
+        std::vector<ModelA> dataA;
+        for (int i = 1; i <= 10; i++)
+            dataA.push_back (ModelA { i, std::to_string (i), i * 0.5,
+                i % 2 ? Nullable<int> (i) : nullptr, nullptr, nullptr });
+        mapper.InsertRange (dataA);
+
+        auto isOdd = mapper.RegisterFunction ("is_odd",
+            [] (int value) { return value % 2 != 0; });
+        auto label = mapper.RegisterFunction ("label",
+            [] (const std::string &str, Nullable<int> value)
+        {
+            return value == nullptr ? str : str + "#" +
+                std::to_string (value.Value ());
+        });
+        auto product = mapper.RegisterAggregate ("product", 1.0,
+            [] (double acc, double value) { return acc * value; },
+            [] (double acc) { return acc; });
+        auto joined = mapper.RegisterAggregate ("joined", std::string {},
+            [] (std::string acc, const std::string &str)
+        {
+            return acc.empty () ? str : acc + "," + str;
+        },
+            [] (const std::string &acc) { return "[" + acc + "]"; });
+
+        // Evaluated inside the Engine
+        auto odds = mapper.Query (ma)
+            .Where (isOdd (field (ma.a_int)) == true)
+            .ToVector ();
+        REQUIRE (odds.size () == 5);
+        REQUIRE (odds[0].a_int == 1);
+
+        auto labels = mapper.Query (ma)
+            .Where (field (ma.a_int) <= 2)
+            .Select (label (field (ma.a_string), field (ma.an_int)))
+            .ToVector ();
+        REQUIRE (labels.size () == 2);
+        REQUIRE (std::get<0> (labels[0]).Value () == "1#1");
+        REQUIRE (std::get<0> (labels[1]).Value () == "2");
+
+        REQUIRE (mapper.Query (ma)
+            .Where (field (ma.a_int) <= 4)
+            .Aggregate (product (field (ma.a_double))).Value () == 1.5);
+        REQUIRE (mapper.Query (ma)
+            .Where (field (ma.a_int) >= 9)
+            .Aggregate (joined (field (ma.a_string))).Value () == "[9,10]");
+
+        // No Row
+        REQUIRE (mapper.Query (ma)
+            .Where (field (ma.a_int) > 10)
+            .Aggregate (product (field (ma.a_double))).Value () == 1.0);
+
+        // NULL to a NOT Nullable Parameter
+        REQUIRE_THROWS (mapper.Query (ma)
+            .Where (isOdd (field (ma.an_int)) == true)
+            .ToVector ());
+
+        // Registered on Pooled Connections
+        auto snapshot = mapper.Snapshot ();
+        auto isEven = mapper.RegisterFunction ("is_even",
+            [] (int value) { return value % 2 == 0; });
+        REQUIRE (mapper.Query (ma)
+            .Where (isOdd (field (ma.a_int)) == true)
+            .Parallel (4).ToVector ().size () == 5);
+        REQUIRE (snapshot.Query (ma)
+            .Where (isEven (field (ma.a_int)) == true)
+            .Parallel (4).ToVector ().size () == 5);
+        REQUIRE (snapshot.Query (ma)
+            .Aggregate (joined (field (ma.a_string))).Value () ==
+            "[1,2,3,4,5,6,7,8,9,10]");
+    }
+
+    // after
+    SetJournalMode ("DELETE");
+}
+
+TEST_CASE ("virtual table of vector")
+{
+    ModelA ma;
+    ModelF mf, incoming, archived;
+    auto field = FieldExtractor { ma, mf,
+        Named ("incoming", incoming), Named ("archived", archived) };
+
+    // before
+    ResetTables (ModelA {}, ModelF {});
+    SetJournalMode ("WAL");
+
+    // test
+    {
+        ORMapper mapper (TESTDB);
+        std::vector<ModelA> dataA;
+        for (int i = 1; i <= 5; i++)
+            dataA.push_back (ModelA { i, std::to_string (i), i * 0.5,
+                nullptr, nullptr, nullptr });
+        mapper.InsertRange (dataA);
+        mapper.InsertRange (std::vector<ModelF> {
+            ModelF { 2, "old two", 1.0 },
+            ModelF { 3, "old three", nullptr }
+        });
+
+        std::vector<ModelF> dataF {
+            ModelF { 2, "two", 2.0 },
+            ModelF { 4, "four", nullptr },
+            ModelF { 4, "dup", 4.5 },
+            ModelF { 7, "seven", 7.0 }
+        };
+        std::vector<ModelF> dataArchived {
+            ModelF { 3, "three", 3.0 }
+        };
+        mapper.Expose ("incoming", dataF);
+        mapper.Expose ("archived", dataArchived);
+
+        auto exposed = mapper.Query (Named ("incoming", incoming));
+        REQUIRE (exposed.ToVector ().size () == 4);
+        REQUIRE (exposed.Aggregate (
+            Sum (field (incoming.fn_weight))).Value () == 13.5);
+        REQUIRE (mapper.Query (Named ("archived", archived))
+            .ToVector ()[0].f_name == "three");
+        REQUIRE (mapper.Query (mf).Aggregate (Count ()).Value () == 2);
+
+        // Lookup by Key
+        auto fours = exposed
+            .Where (field (incoming.f_key) == 4)
+            .ToVector ();
+        REQUIRE (fours.size () == 2);
+        REQUIRE (fours[0].f_name == "four");
+        REQUIRE (fours[0].fn_weight == nullptr);
+        REQUIRE (fours[1].f_name == "dup");
+        REQUIRE (exposed
+            .Where (field (incoming.f_key) == 3)
+            .ToVector ().empty ());
+
+        // Join with a Table
+        auto joined = exposed
+            .Join (ma, field (incoming.f_key) == field (ma.a_int))
+            .OrderBy (field (incoming.f_name))
+            .Select (field (incoming.f_name), field (ma.a_double))
+            .ToVector ();
+        REQUIRE (joined.size () == 3);
+        REQUIRE (std::get<0> (joined[0]).Value () == "dup");
+        REQUIRE (std::get<1> (joined[0]).Value () == 2.0);
+        REQUIRE (std::get<0> (joined[2]).Value () == "two");
+
+        // Join with the Table of the Same Model
+        auto updated = mapper.Query (mf)
+            .Join (Named ("incoming", incoming),
+                field (mf.f_key) == field (incoming.f_key))
+            .Select (field (mf.f_name), field (incoming.f_name))
+            .ToVector ();
+        REQUIRE (updated.size () == 1);
+        REQUIRE (std::get<0> (updated[0]).Value () == "old two");
+        REQUIRE (std::get<1> (updated[0]).Value () == "two");
+        REQUIRE (mapper.Query (mf)
+            .LeftJoin (Named ("archived", archived),
+                field (mf.f_key) == field (archived.f_key))
+            .Where (field (archived.fn_weight) == nullptr)
+            .ToVector ().size () == 1);
+
+        // Expose again after Modifying
+        dataF.push_back (ModelF { 5, "five", nullptr });
+        mapper.Expose ("incoming", dataF);
+        REQUIRE (exposed.Aggregate (
+            Count ()).Value () == 5);
+        REQUIRE (exposed
+            .Where (field (incoming.f_key) == 5)
+            .ToVector ().size () == 1);
+
+        // Registered on Pooled Connections
+        auto snapshot = mapper.Snapshot ();
+        REQUIRE (snapshot.Query (Named ("incoming", incoming))
+            .Join (mf, field (incoming.f_key) == field (mf.f_key))
+            .ToVector ().size () == 1);
+
+        // Name of another Model
+        REQUIRE_THROWS (mapper.Expose ("incoming", dataA));
+    }
+
+    // after
+    SetJournalMode ("DELETE");
+}
+
+TEST_CASE ("full-text search")
+{
+    ModelA ma;
+    auto field = FieldExtractor { ma };
+
+    // before
+    ResetTables (ModelA {});
+
+    // test
+    ORMapper mapper (TESTDB);
+    mapper.Insert (ModelA { 1, "red apple pie", 1.0,
+        nullptr, nullptr, nullptr });
+
+    // Existing Rows are Indexed
+    mapper.CreateIndex (ma, Constraint::FullText (field (ma.a_string)));
+    mapper.InsertRange (std::vector<ModelA> {
+        ModelA { 2, "green apple", 2.0, nullptr, nullptr, nullptr },
+        ModelA { 3, "apple apple apple", 3.0, nullptr, nullptr, nullptr },
+        ModelA { 4, "banana split", 4.0, nullptr, nullptr, nullptr },
+        ModelA { 5, "applesauce", 5.0, nullptr, nullptr, nullptr }
+    });
+
+    auto search = [&] (const std::string &query)
+    {
+        return mapper.Query (ma)
+            .Where (Match (field (ma.a_string), query))
+            .OrderBy (field (ma.a_int))
+            .ToVector ();
+    };
+    REQUIRE (search ("apple").size () == 3);
+    REQUIRE (search ("app*").size () == 4);
+    REQUIRE (search ("apple NOT pie").size () == 2);
+    REQUIRE (mapper.Query (ma)
+        .Where (Match (field (ma.a_string), "apple") &&
+            field (ma.a_int) > 1)
+        .ToVector ().size () == 2);
+
+    // BM25 Ordering (by Joining the Index Once)
+    auto reports = std::vector<QueryReport> {};
+    mapper.OnQuery ([&reports] (const QueryReport &report)
+    {
+        reports.push_back (report);
+    });
+    auto ranked = mapper.Query (ma)
+        .Search (field (ma.a_string), "apple")
+        .Where (field (ma.a_int) > 1)
+        .OrderBy (Rank (field (ma.a_string)))
+        .ToVector ();
+    REQUIRE (ranked.size () == 2);
+    REQUIRE (ranked[0].a_int == 3);
+    REQUIRE (reports.back ().sql ==
+        "select ModelA.* from ModelA join ModelA_fts_a_string "
+        "on ModelA_fts_a_string.rowid=ModelA.rowid and "
+        "ModelA_fts_a_string match 'apple' "
+        "where (ModelA.a_int>1) order by ModelA_fts_a_string.rank;");
+    REQUIRE (mapper.Query (ma)
+        .Search (field (ma.a_string), "apple")
+        .Aggregate (Count ()).Value () == 3);
+    mapper.OnQuery (nullptr);
+
+    // Synchronized by Triggers
+    mapper.Update (ModelA { 4, "apple banana", 4.0,
+        nullptr, nullptr, nullptr });
+    mapper.Delete (ModelA { 1, "", 0, nullptr, nullptr, nullptr });
+    auto apples = search ("apple");
+    REQUIRE (apples.size () == 3);
+    REQUIRE (apples[0].a_int == 2);
+    REQUIRE (apples[2].a_int == 4);
+    REQUIRE (search ("pie").empty ());
+
+    mapper.DropIndex (ma, Constraint::FullText (field (ma.a_string)));
+    REQUIRE_THROWS (search ("apple"));
+
+    // Created with the Table (and Dropped with it)
+    mapper.DropTbl (ma);
+    mapper.CreateTbl (ma, Constraint::FullText (field (ma.an_string)));
+    mapper.Insert (ModelA { 1, "", 0, nullptr, nullptr, "full text" });
+    mapper.Insert (ModelA { 2, "", 0, nullptr, nullptr, nullptr });
+    REQUIRE (mapper.Query (ma)
+        .Where (Match (field (ma.an_string), "text"))
+        .ToVector ().size () == 1);
+    mapper.DropTbl (ma);
+    mapper.CreateTbl (ma, Constraint::FullText (field (ma.an_string)));
+}
+
+TEST_CASE ("spatial index")
+{
+    ModelG mg {};
+    auto field = FieldExtractor { mg };
+    auto bounds = Constraint::CompositeField {
+        field (mg.g_xmin), field (mg.g_xmax),
+        field (mg.g_ymin), field (mg.g_ymax) };
+
+    // before
+    ResetTables (ModelG {});
+
+    // test
+    ORMapper mapper (TESTDB);
+    mapper.Insert (ModelG { 1, 0, 1, 0, 1 });
+
+    // Existing Rows are Indexed
+    mapper.CreateIndex (mg, Constraint::Spatial (bounds));
+    mapper.InsertRange (std::vector<ModelG> {
+        ModelG { 2, 2, 3, 2, 3 },
+        ModelG { 3, 0.5, 2.5, 0.5, 2.5 },
+        ModelG { 4, 10, 11, 10, 11 },
+        ModelG { 5, 0.1, 0.2, 0.1, 0.2 }
+    });
+
+    auto search = [&] (const Expression::Expr &expr)
+    {
+        std::vector<int> ret;
+        for (const auto &row : mapper.Query (mg)
+            .Where (expr)
+            .OrderBy (field (mg.g_id))
+            .ToVector ())
+            ret.push_back (row.g_id);
+        return ret;
+    };
+    REQUIRE (search (Overlaps (bounds,
+        std::vector<double> { 0.9, 2.1, 0.9, 2.1 })) ==
+        std::vector<int> { 1, 2, 3 });
+    REQUIRE (search (Within (bounds,
+        std::vector<double> { 0, 2, 0, 2 })) ==
+        std::vector<int> { 1, 5 });
+
+    // Exact Bounds (NOT Rounded as in R*Tree)
+    REQUIRE (search (Within (bounds,
+        std::vector<double> { 0.1, 0.2, 0.1, 0.2 })) ==
+        std::vector<int> { 5 });
+    REQUIRE (search (Overlaps (bounds,
+        std::vector<double> { 0.20000001, 0.3, 0.1, 0.2 }) &&
+        field (mg.g_id) == 5).empty ());
+
+    // Combined with other Conditions
+    REQUIRE (search (Overlaps (bounds,
+        std::vector<double> { 0, 100, 0, 100 }) &&
+        field (mg.g_id) > 3) == std::vector<int> { 4, 5 });
+
+    // Synchronized by Triggers
+    mapper.Update (ModelG { 4, 0.5, 0.6, 0.5, 0.6 });
+    mapper.Delete (ModelG { 1, 0, 0, 0, 0 });
+    REQUIRE (search (Within (bounds,
+        std::vector<double> { 0, 1, 0, 1 })) ==
+        std::vector<int> { 4, 5 });
+
+    // Inverted Boxes are Stored but NOT Indexed
+    mapper.Insert (ModelG { 6, 1, 0, 0, 1 });
+    mapper.Update (ModelG { 5, 0.2, 0.1, 0.1, 0.2 });
+    REQUIRE (search (Within (bounds,
+        std::vector<double> { 0, 1, 0, 1 })) ==
+        std::vector<int> { 4 });
+    REQUIRE (mapper.Query (mg).Aggregate (Count ()).Value () == 5);
+
+    REQUIRE_THROWS (Overlaps (bounds, std::vector<double> { 0, 1 }));
+    REQUIRE_THROWS (Constraint::Spatial (
+        Constraint::CompositeField { field (mg.g_xmin) }));
+
+    mapper.DropIndex (mg, Constraint::Spatial (bounds));
+    REQUIRE_THROWS (search (Overlaps (bounds,
+        std::vector<double> { 0, 1, 0, 1 })));
+
+    // Created with the Table (and Dropped with it)
+    mapper.DropTbl (mg);
+    mapper.CreateTbl (mg, Constraint::Spatial (
+        Constraint::CompositeField { field (mg.g_xmin), field (mg.g_xmax) }));
+    mapper.Insert (ModelG { 1, 5, 6, 0, 0 });
+    REQUIRE (mapper.Query (mg)
+        .Where (Overlaps (Constraint::CompositeField {
+            field (mg.g_xmin), field (mg.g_xmax) },
+            std::vector<double> { 6, 7 }))
+        .ToVector ().size () == 1);
+    mapper.DropTbl (mg);
+
+    // Indexes are Synced by Rowid
+    REQUIRE_THROWS_WITH (mapper.CreateTbl (mg, Constraint::WithoutRowid (),
+        Constraint::Spatial (bounds)),
+        "Full-text / Spatial Index requires a Rowid Table");
+    mapper.CreateTbl (mg);
+}
+
+TEST_CASE ("blob fields")
+{
+    ModelH mh;
+    auto field = FieldExtractor { mh };
+
+    // before
+    ResetTables (ModelH {});
+
+    // test
+    ORMapper mapper (TESTDB);
+    const Blob bytes { 0, 1, 2, 0, 255 };
+    mapper.Insert (ModelH { 1, bytes, nullptr });
+    mapper.InsertRange (std::vector<ModelH> {
+        ModelH { 2, Blob {}, Blob { 0 } },
+        ModelH { 3, Blob (1000, 0xAB), nullptr }
+    });
+
+    auto rows = mapper.Query (mh).OrderBy (field (mh.h_id)).ToVector ();
+    REQUIRE (rows.size () == 3);
+    REQUIRE (rows[0].h_data == bytes);
+    REQUIRE (rows[0].hn_data == nullptr);
+    REQUIRE (rows[1].h_data.empty ());
+    REQUIRE (rows[1].hn_data.Value () == Blob { 0 });
+    REQUIRE (rows[2].h_data == Blob (1000, 0xAB));
+
+    // Literals in Expressions
+    REQUIRE (mapper.Query (mh)
+        .Where (field (mh.h_data) == bytes)
+        .ToVector ().size () == 1);
+    mapper.Update (mh, field (mh.hn_data) = Blob { 7, 0 },
+        field (mh.h_id) == 1);
+    REQUIRE (mapper.Query (mh)
+        .Where (field (mh.h_id) == 1)
+        .Select (field (mh.hn_data))
+        .ToVector ()[0] == std::make_tuple (Nullable<Blob> (Blob { 7, 0 })));
+
+    // Read by the Type of the Field (the Same as Find)
+    {
+        sqlite3 *db;
+        sqlite3_open (TESTDB, &db);
+        sqlite3_exec (db,
+            "insert into ModelH values (6, 'hello', x'414243');",
+            nullptr, nullptr, nullptr);
+        sqlite3_close (db);
+    }
+    auto blobRow = mapper.Query (mh)
+        .Where (field (mh.h_id) == 6).ToVector ();
+    REQUIRE (blobRow[0].h_data == Blob { 'h', 'e', 'l', 'l', 'o' });
+    REQUIRE (blobRow[0].hn_data.Value () == Blob { 'A', 'B', 'C' });
+    REQUIRE (mapper.Find (ModelH { 6, {}, nullptr }).Value ().h_data ==
+        blobRow[0].h_data);
+
+    ModelHText mt;
+    auto textRow = mapper.Query (mt)
+        .Where (field (mh.h_id) == 6).ToVector ();
+    REQUIRE (textRow[0].h_data == "hello");
+    REQUIRE (textRow[0].hn_data.Value () == "ABC");
+    REQUIRE (mapper.Find (ModelHText { 6, "", nullptr }).Value ()
+        .hn_data.Value () == "ABC");
+    mapper.Delete (ModelH { 6, {}, nullptr });
+
+    // User Functions
+    auto blobSize = mapper.RegisterFunction ("blob_size",
+        [] (const Blob &blob) { return (int) blob.size (); });
+    REQUIRE (mapper.Query (mh)
+        .Where (blobSize (field (mh.h_data)) > 10)
+        .ToVector ().size () == 1);
+
+    // Bound without Copying, and Write-only
+    std::vector<std::uint8_t> buffer (64, 0x5A);
+    mapper.Insert (ModelHView { 4,
+        BlobView { buffer.data (), buffer.size () }, nullptr });
+    REQUIRE (mapper.Query (mh)
+        .Where (field (mh.h_id) == 4)
+        .ToVector ()[0].h_data == buffer);
+    REQUIRE_THROWS (mapper.Query (ModelHView {}).ToVector ());
+
+    // Incremental I/O
+    const size_t size = 1 << 20;
+    auto rowid = mapper.Insert (ModelHView { 5,
+        BlobView { nullptr, size }, nullptr });
+    {
+        auto stream = mapper.OpenBlob (field (mh.h_data), rowid, true);
+        REQUIRE (stream.Size () == size);
+
+        std::vector<std::uint8_t> chunk (4096);
+        for (size_t offset = 0; offset < size; offset += chunk.size ())
+        {
+            std::fill (chunk.begin (), chunk.end (),
+                std::uint8_t (offset / chunk.size ()));
+            stream.Write (chunk.data (), chunk.size (), offset);
+        }
+
+        std::uint8_t byte = 0;
+        stream.Read (&byte, 1, size - 1);
+        REQUIRE (byte == std::uint8_t (size / chunk.size () - 1));
+        REQUIRE_THROWS (stream.Read (&byte, 1, size));
+
+        stream.MoveTo (1);
+        REQUIRE (stream.Size () == bytes.size ());
+    }
+    {
+        auto stream = mapper.OpenBlob (field (mh.h_data), rowid);
+        std::uint8_t byte = 0;
+        REQUIRE_THROWS (stream.Write (&byte, 1, 0));
+    }
+    REQUIRE_THROWS (mapper.OpenBlob (field (mh.h_data), 100));
+
+    auto large = mapper.Query (mh)
+        .Where (field (mh.h_id) == 5)
+        .ToVector ();
+    REQUIRE (large[0].h_data.size () == size);
+    REQUIRE (large[0].h_data[4096] == 1);
+}
+
+TEST_CASE ("compressed fields")
+{
+    ModelI mi;
+    auto field = FieldExtractor { mi };
+
+    // before
+    ResetTables (ModelI {});
+
+    // test
+    ORMapper mapper (TESTDB);
+    mapper.DropTbl (mi);
+    mapper.CreateTbl (mi,
+        Constraint::Compressed (field (mi.i_doc)),
+        Constraint::Compressed (field (mi.in_doc)));
+
+    auto doc = std::string {};
+    for (int i = 0; i < 200; i++)
+        doc += "{\"id\": " + std::to_string (i) + ", \"tag\": \"orm\"},";
+
+    mapper.Insert (ModelI { 1, doc, nullptr });
+    mapper.Insert (ModelI { 2, "short", doc });
+
+    auto stats = mapper.CompressionMetrics ();
+    REQUIRE (stats.values == 3);
+    REQUIRE (stats.compressed == 2);
+    REQUIRE (stats.storedBytes < stats.rawBytes);
+
+    // Stored as Blob only if Smaller
+    sqlite3 *db;
+    sqlite3_open (TESTDB, &db);
+    sqlite3_stmt *stmt;
+    sqlite3_prepare_v2 (db,
+        "select typeof(i_doc), typeof(in_doc) from ModelI order by i_id;",
+        -1, &stmt, nullptr);
+    REQUIRE (sqlite3_step (stmt) == SQLITE_ROW);
+    REQUIRE (std::string ((const char *) sqlite3_column_text (stmt, 0))
+             == "blob");
+    REQUIRE (sqlite3_step (stmt) == SQLITE_ROW);
+    REQUIRE (std::string ((const char *) sqlite3_column_text (stmt, 0))
+             == "text");
+    REQUIRE (std::string ((const char *) sqlite3_column_text (stmt, 1))
+             == "blob");
+    sqlite3_finalize (stmt);
+    sqlite3_close (db);
+
+    // Decompressed Transparently
+    auto reports = std::vector<QueryReport> {};
+    mapper.OnQuery ([&reports] (const QueryReport &report)
+    {
+        reports.push_back (report);
+    });
+
+    auto rows = mapper.Query (mi).OrderBy (field (mi.i_id)).ToVector ();
+    REQUIRE (rows.size () == 2);
+    REQUIRE (rows[0].i_doc == doc);
+    REQUIRE (rows[0].in_doc == nullptr);
+    REQUIRE (rows[1].i_doc == "short");
+    REQUIRE (rows[1].in_doc == doc);
+    REQUIRE (reports.back ().stats.decompressed == 2);
+
+    auto found = mapper.Find (ModelI { 1, "", nullptr });
+    REQUIRE (found.Value ().i_doc == doc);
+
+    mapper.Update (ModelI { 2, doc + doc, nullptr });
+    REQUIRE (mapper.Query (mi)
+        .Where (field (mi.i_id) == 2)
+        .Select (field (mi.i_doc))
+        .ToVector ()[0] == std::make_tuple (doc + doc));
+    REQUIRE (mapper.CompressionMetrics ().compressed == 3);
+
+    // Corrupt Raw Size is Rejected rather than Allocated
+    sqlite3_open (TESTDB, &db);
+    sqlite3_exec (db,
+        "update ModelI set i_doc = X'FFFFFFFFFFFFFF7F00' where i_id = 2;",
+        nullptr, nullptr, nullptr);
+    sqlite3_close (db);
+    auto error = std::string {};
+    try
+    {
+        mapper.Query (mi).ToVector ();
+    }
+    catch (const std::exception &e)
+    {
+        error = e.what ();
+    }
+    REQUIRE (error.find ("Bad Compressed Value") != std::string::npos);
+
+    // Schema is Reloaded after Restore
+    std::remove ("plain.db");
+    {
+        ORMapper plain ("plain.db");
+        plain.CreateTbl (mi);
+    }
+    mapper.Restore ("plain.db");
+    mapper.Insert (ModelI { 3, doc, doc });
+    REQUIRE (mapper.CompressionMetrics ().compressed == 3);
+
+    auto restored = mapper.Query (mi).ToVector ();
+    REQUIRE (restored.size () == 1);
+    REQUIRE (restored[0].i_doc == doc);
+    REQUIRE (restored[0].in_doc == doc);
+}
+
 TEST_CASE ("handle existing table")
 {
     // before